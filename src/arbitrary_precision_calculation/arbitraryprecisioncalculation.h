@@ -44,5 +44,10 @@
 #include "arbitrary_precision_calculation/random_number_generator.h"
 #include "arbitrary_precision_calculation/parse.h"
 #include "arbitrary_precision_calculation/configuration.h"
+#include "arbitrary_precision_calculation/precision_check_policy.h"
+#include "arbitrary_precision_calculation/real.h"
+#include "arbitrary_precision_calculation/scoped_mpft_arena.h"
+#include "arbitrary_precision_calculation/limb_allocator.h"
+#include "arbitrary_precision_calculation/constant_calculation.h"
 
 #endif /* ARBITRARY_PRECISION_CALCULATION_INCLUDES_H_ */
@@ -39,6 +39,9 @@
 
 #include "arbitrary_precision_calculation/configuration.h"
 
+#include <limits.h>
+
+#include "arbitrary_precision_calculation/check_condition.h"
 #include "arbitrary_precision_calculation/random_number_generator.h"
 
 namespace arbitraryprecisioncalculation {
@@ -52,10 +55,24 @@ double Configuration::check_precision_probability_ = 1.00;
 // <= 0 -> surely not check
 // >= 1 -> surely check
 // > 0 && < 1 -> randomly check
-bool Configuration::increase_precision_recommended_ = false;
+std::atomic<bool> Configuration::increase_precision_recommended_(false);
+std::atomic<unsigned long> Configuration::recommended_precision_(0);
+arbitraryprecisioncalculation::configuration::PrecisionGrowthStrategy Configuration::precision_growth_strategy_ = arbitraryprecisioncalculation::configuration::PRECISION_GROWTH_LINEAR;
+double Configuration::precision_growth_factor_ = 1.5;
+int Configuration::constant_calculation_threads_ = 1;
 
 int Configuration::output_precision_ = 5;
 
+int Configuration::maximal_cached_released_mpft_values_ = -1;
+long long Configuration::maximal_cached_released_mpft_limb_bytes_ = -1;
+
+// measurements showed the Taylor series to be faster than the CORDIC algorithm for all precisions from 256 to 16384 bits
+// and the arithmetic-geometric mean to be faster than the series of the logarithm from 8192 bits on
+arbitraryprecisioncalculation::configuration::TrigonometricAlgorithm Configuration::trigonometric_algorithm_ = arbitraryprecisioncalculation::configuration::TRIGONOMETRIC_ALGORITHM_AUTOMATIC;
+unsigned long Configuration::cordic_minimal_precision_ = ULONG_MAX;
+arbitraryprecisioncalculation::configuration::LogarithmAlgorithm Configuration::logarithm_algorithm_ = arbitraryprecisioncalculation::configuration::LOGARITHM_ALGORITHM_AUTOMATIC;
+unsigned long Configuration::log_agm_minimal_precision_ = 8192;
+
 RandomNumberGenerator* Configuration::standard_random_number_generator_ = new FastM2P63LinearCongruenceRandomNumberGenerator(1571204578482947281ULL, 12345678901234567ULL, 0);
 
 void Configuration::Init(){
@@ -67,42 +84,81 @@ void Configuration::Init(){
 	check_precision_mode_ = arbitraryprecisioncalculation::configuration::CHECK_PRECISION_ALWAYS_EXCEPT_STATISTICS;
 	check_precision_probability_ = 1.00;
 	increase_precision_recommended_ = false;
+	recommended_precision_ = 0;
+	precision_growth_strategy_ = arbitraryprecisioncalculation::configuration::PRECISION_GROWTH_LINEAR;
+	precision_growth_factor_ = 1.5;
+	constant_calculation_threads_ = 1;
 
 	output_precision_ = 5;
 
-	standard_random_number_generator_ = new FastM2P63LinearCongruenceRandomNumberGenerator(1571204578482947281ULL, 12345678901234567ULL, 0);
-}
+	maximal_cached_released_mpft_values_ = -1;
+	maximal_cached_released_mpft_limb_bytes_ = -1;
 
+	trigonometric_algorithm_ = arbitraryprecisioncalculation::configuration::TRIGONOMETRIC_ALGORITHM_AUTOMATIC;
+	cordic_minimal_precision_ = ULONG_MAX;
+	logarithm_algorithm_ = arbitraryprecisioncalculation::configuration::LOGARITHM_ALGORITHM_AUTOMATIC;
+	log_agm_minimal_precision_ = 8192;
 
-arbitraryprecisioncalculation::configuration::CheckPrecisionMode Configuration::getCheckPrecisionMode() {
-	return check_precision_mode_;
+	standard_random_number_generator_ = new FastM2P63LinearCongruenceRandomNumberGenerator(1571204578482947281ULL, 12345678901234567ULL, 0);
 }
 
+
 void Configuration::setCheckPrecisionMode(
 		arbitraryprecisioncalculation::configuration::CheckPrecisionMode checkPrecisionMode) {
 	check_precision_mode_ = checkPrecisionMode;
 }
 
-double Configuration::getCheckPrecisionProbability() {
-	return check_precision_probability_;
-}
-
 void Configuration::setCheckPrecisionProbability(double checkPrecisionProbability) {
 	check_precision_probability_ = checkPrecisionProbability;
 }
 
-bool Configuration::isIncreasePrecisionRecommended() {
-	return increase_precision_recommended_;
-}
-
 void Configuration::ResetIncreasePrecisionRecommended() {
 	increase_precision_recommended_ = false;
+	recommended_precision_ = 0;
 }
 
 void Configuration::RecommendIncreasePrecision() {
 	increase_precision_recommended_ = true;
 }
 
+void Configuration::RecommendIncreasePrecision(unsigned long neededPrecision) {
+	unsigned long current = recommended_precision_.load(std::memory_order_relaxed);
+	while (current < neededPrecision && !recommended_precision_.compare_exchange_weak(current, neededPrecision)) {
+	}
+	increase_precision_recommended_ = true;
+}
+
+unsigned long Configuration::getRecommendedPrecision() {
+	return recommended_precision_;
+}
+
+arbitraryprecisioncalculation::configuration::PrecisionGrowthStrategy Configuration::getPrecisionGrowthStrategy() {
+	return precision_growth_strategy_;
+}
+
+void Configuration::setPrecisionGrowthStrategy(
+		arbitraryprecisioncalculation::configuration::PrecisionGrowthStrategy precisionGrowthStrategy) {
+	precision_growth_strategy_ = precisionGrowthStrategy;
+}
+
+double Configuration::getPrecisionGrowthFactor() {
+	return precision_growth_factor_;
+}
+
+void Configuration::setPrecisionGrowthFactor(double precisionGrowthFactor) {
+	AssertCondition(precisionGrowthFactor > 1.0, "The precision growth factor has to be larger than one.");
+	precision_growth_factor_ = precisionGrowthFactor;
+}
+
+int Configuration::getConstantCalculationThreads() {
+	return constant_calculation_threads_;
+}
+
+void Configuration::setConstantCalculationThreads(int constantCalculationThreads) {
+	AssertCondition(constantCalculationThreads > 0, "The number of threads for the calculation of constants has to be positive.");
+	constant_calculation_threads_ = constantCalculationThreads;
+}
+
 int Configuration::getInitialPrecision() {
 	return initial_precision_;
 }
@@ -124,10 +180,6 @@ void Configuration::setOutputPrecision(int outputPrecision) {
 	output_precision_ = outputPrecision;
 }
 
-int Configuration::getPrecisionSafetyMargin() {
-	return precision_safety_margin_;
-}
-
 void Configuration::setPrecisionSafetyMargin(int precisionSafetyMargin) {
 	precision_safety_margin_ = precisionSafetyMargin;
 	if(!initial_precision_already_set_){
@@ -136,6 +188,80 @@ void Configuration::setPrecisionSafetyMargin(int precisionSafetyMargin) {
 	}
 }
 
+int Configuration::getMaximalCachedReleasedMpftValues() {
+	return maximal_cached_released_mpft_values_;
+}
+
+void Configuration::setMaximalCachedReleasedMpftValues(int maximalCachedReleasedMpftValues) {
+	maximal_cached_released_mpft_values_ = maximalCachedReleasedMpftValues;
+}
+
+long long Configuration::getMaximalCachedReleasedMpftLimbBytes() {
+	return maximal_cached_released_mpft_limb_bytes_;
+}
+
+void Configuration::setMaximalCachedReleasedMpftLimbBytes(long long maximalCachedReleasedMpftLimbBytes) {
+	maximal_cached_released_mpft_limb_bytes_ = maximalCachedReleasedMpftLimbBytes;
+}
+
+arbitraryprecisioncalculation::configuration::TrigonometricAlgorithm Configuration::getTrigonometricAlgorithm() {
+	return trigonometric_algorithm_;
+}
+
+void Configuration::setTrigonometricAlgorithm(
+		arbitraryprecisioncalculation::configuration::TrigonometricAlgorithm trigonometricAlgorithm) {
+	trigonometric_algorithm_ = trigonometricAlgorithm;
+}
+
+unsigned long Configuration::getCordicMinimalPrecision() {
+	return cordic_minimal_precision_;
+}
+
+void Configuration::setCordicMinimalPrecision(unsigned long cordicMinimalPrecision) {
+	cordic_minimal_precision_ = cordicMinimalPrecision;
+}
+
+arbitraryprecisioncalculation::configuration::LogarithmAlgorithm Configuration::getLogarithmAlgorithm() {
+	return logarithm_algorithm_;
+}
+
+void Configuration::setLogarithmAlgorithm(
+		arbitraryprecisioncalculation::configuration::LogarithmAlgorithm logarithmAlgorithm) {
+	logarithm_algorithm_ = logarithmAlgorithm;
+}
+
+unsigned long Configuration::getLogAgmMinimalPrecision() {
+	return log_agm_minimal_precision_;
+}
+
+void Configuration::setLogAgmMinimalPrecision(unsigned long logAgmMinimalPrecision) {
+	log_agm_minimal_precision_ = logAgmMinimalPrecision;
+}
+
+void Configuration::StoreAlgorithmProfile(std::ofstream* output_stream) {
+	(*output_stream) << (int)trigonometric_algorithm_ << " " << cordic_minimal_precision_ << std::endl;
+	(*output_stream) << (int)logarithm_algorithm_ << " " << log_agm_minimal_precision_ << std::endl;
+}
+
+void Configuration::LoadAlgorithmProfile(std::ifstream* input_stream) {
+	int trigonometric_algorithm;
+	unsigned long cordic_minimal_precision;
+	int logarithm_algorithm;
+	unsigned long log_agm_minimal_precision;
+	(*input_stream) >> trigonometric_algorithm >> cordic_minimal_precision >> logarithm_algorithm >> log_agm_minimal_precision;
+	AssertCondition(!input_stream->fail(), "The algorithm profile could not be read.");
+	AssertCondition(trigonometric_algorithm >= (int)arbitraryprecisioncalculation::configuration::TRIGONOMETRIC_ALGORITHM_AUTOMATIC
+			&& trigonometric_algorithm <= (int)arbitraryprecisioncalculation::configuration::TRIGONOMETRIC_ALGORITHM_CORDIC,
+			"The algorithm profile contains an unknown trigonometric algorithm.");
+	AssertCondition(logarithm_algorithm >= (int)arbitraryprecisioncalculation::configuration::LOGARITHM_ALGORITHM_AUTOMATIC
+			&& logarithm_algorithm <= (int)arbitraryprecisioncalculation::configuration::LOGARITHM_ALGORITHM_AGM,
+			"The algorithm profile contains an unknown logarithm algorithm.");
+	trigonometric_algorithm_ = (arbitraryprecisioncalculation::configuration::TrigonometricAlgorithm)trigonometric_algorithm;
+	cordic_minimal_precision_ = cordic_minimal_precision;
+	logarithm_algorithm_ = (arbitraryprecisioncalculation::configuration::LogarithmAlgorithm)logarithm_algorithm;
+	log_agm_minimal_precision_ = log_agm_minimal_precision;
+}
+
 RandomNumberGenerator* Configuration::getStandardRandomNumberGenerator() {
 	return standard_random_number_generator_;
 }
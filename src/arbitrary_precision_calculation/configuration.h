@@ -40,6 +40,8 @@
 #ifndef ARBITRARY_PRECISION_CALCULATION_CONFIGURATION_H_
 #define ARBITRARY_PRECISION_CALCULATION_CONFIGURATION_H_
 
+#include <atomic>
+#include <fstream>
 #include <string>
 #include <vector>
 
@@ -71,6 +73,58 @@ enum CheckPrecisionMode {
 	*/
 	CHECK_PRECISION_NEVER
 };
+/**
+* @brief Specification possibilities how IncreasePrecision determines the new precision.
+*/
+enum PrecisionGrowthStrategy {
+	/**
+	* @brief The precision is increased by 10 bits.
+	*/
+	PRECISION_GROWTH_LINEAR,
+	/**
+	* @brief The precision is multiplied by the precision growth factor, but at least the recommended precision is used.
+	*/
+	PRECISION_GROWTH_GEOMETRIC,
+	/**
+	* @brief The precision is set to the recommended precision, i.e. the smallest precision for which all checked additions would have passed.
+	*/
+	PRECISION_GROWTH_EXACT
+};
+/**
+* @brief Specification possibilities which algorithm calculates sine and cosine of the reduced argument.
+*/
+enum TrigonometricAlgorithm {
+	/**
+	* @brief The CORDIC algorithm is used from the CORDIC minimal precision on, the Taylor series otherwise.
+	*/
+	TRIGONOMETRIC_ALGORITHM_AUTOMATIC,
+	/**
+	* @brief The Taylor series is used for all precisions.
+	*/
+	TRIGONOMETRIC_ALGORITHM_TAYLOR,
+	/**
+	* @brief The CORDIC algorithm is used for all precisions.
+	*/
+	TRIGONOMETRIC_ALGORITHM_CORDIC
+};
+/**
+* @brief Specification possibilities which algorithm calculates the natural logarithm.
+*/
+enum LogarithmAlgorithm {
+	/**
+	* @brief The arithmetic-geometric mean is used from the AGM minimal precision on, the series otherwise.
+	*/
+	LOGARITHM_ALGORITHM_AUTOMATIC,
+	/**
+	* @brief The series of atanh after a table lookup is used for all precisions.
+	*/
+	LOGARITHM_ALGORITHM_SERIES,
+	/**
+	* @brief The arithmetic-geometric mean is used for all precisions.
+	* Arguments close to one still use the series, because the arithmetic-geometric mean would cancel too many bits.
+	*/
+	LOGARITHM_ALGORITHM_AGM
+};
 } // namespace configuration
 
 /**
@@ -89,7 +143,9 @@ public:
 	 *
 	 * @return The current check precision mode.
 	 */
-	static arbitraryprecisioncalculation::configuration::CheckPrecisionMode getCheckPrecisionMode();
+	static inline arbitraryprecisioncalculation::configuration::CheckPrecisionMode getCheckPrecisionMode() {
+		return check_precision_mode_;
+	}
 
 	/**
 	 * @brief Setter function for the check precision mode. Stores the given check precision mode.
@@ -104,7 +160,9 @@ public:
 	 *
 	 * @return The current check precision probability.
 	 */
-	static double getCheckPrecisionProbability();
+	static inline double getCheckPrecisionProbability() {
+		return check_precision_probability_;
+	}
 
 	/**
 	 * @brief Setter function for the check precision probability. Stores the given check precision probability.
@@ -119,10 +177,12 @@ public:
 	 * @retval TRUE if calculations recommend an increase of the precision.
 	 * @retval FALSE otherwise.
 	 */
-	static bool isIncreasePrecisionRecommended();
+	static inline bool isIncreasePrecisionRecommended() {
+		return increase_precision_recommended_.load(std::memory_order_relaxed);
+	}
 
 	/**
-	 * @brief Resets the status whether the precision should be increased to NO.
+	 * @brief Resets the status whether the precision should be increased to NO and forgets the recommended precision.
 	 */
 	static void ResetIncreasePrecisionRecommended();
 
@@ -131,6 +191,67 @@ public:
 	 */
 	static void RecommendIncreasePrecision();
 
+	/**
+	 * @brief Sets the status whether the precision should be increased to YES and records the needed precision.
+	 *
+	 * The recommended precision is the maximum of all needed precisions since the last reset.
+	 *
+	 * @param neededPrecision The precision in bits which is needed by the calculation.
+	 */
+	static void RecommendIncreasePrecision(unsigned long neededPrecision);
+
+	/**
+	 * @brief Getter function for the recommended precision.
+	 *
+	 * @return The maximal needed precision in bits which was recorded since the last reset or 0 if none was recorded.
+	 */
+	static unsigned long getRecommendedPrecision();
+
+	/**
+	 * @brief Getter function for the precision growth strategy.
+	 *
+	 * @return The current precision growth strategy.
+	 */
+	static arbitraryprecisioncalculation::configuration::PrecisionGrowthStrategy getPrecisionGrowthStrategy();
+
+	/**
+	 * @brief Setter function for the precision growth strategy. Stores the given precision growth strategy.
+	 *
+	 * @param precisionGrowthStrategy The new precision growth strategy.
+	 */
+	static void setPrecisionGrowthStrategy(
+			arbitraryprecisioncalculation::configuration::PrecisionGrowthStrategy precisionGrowthStrategy);
+
+	/**
+	 * @brief Getter function for the precision growth factor of the geometric precision growth strategy.
+	 *
+	 * @return The current precision growth factor.
+	 */
+	static double getPrecisionGrowthFactor();
+
+	/**
+	 * @brief Setter function for the precision growth factor of the geometric precision growth strategy.
+	 *
+	 * @param precisionGrowthFactor The new precision growth factor. It has to be larger than one.
+	 */
+	static void setPrecisionGrowthFactor(double precisionGrowthFactor);
+
+	/**
+	 * @brief Getter function for the maximal number of threads which calculate constants like pi.
+	 *
+	 * @return The current maximal number of threads for the calculation of constants.
+	 */
+	static int getConstantCalculationThreads();
+
+	/**
+	 * @brief Setter function for the maximal number of threads which calculate constants like pi.
+	 *
+	 * Additional threads are only used for large precisions.
+	 *
+	 * @param constantCalculationThreads The new maximal number of threads for the calculation of constants. It has to be positive.
+	 */
+	static void setConstantCalculationThreads(int constantCalculationThreads);
+
 	/**
 	 * @brief Getter function for the initial precision.
 	 *
@@ -164,7 +285,9 @@ public:
 	 *
 	 * @return The currently stored precision safety margin.
 	 */
-	static int getPrecisionSafetyMargin();
+	static inline int getPrecisionSafetyMargin() {
+		return precision_safety_margin_;
+	}
 
 	/**
 	 * @brief Setter function for the precision safety margin. Stores the given precision safety margin.
@@ -173,10 +296,117 @@ public:
 	 */
 	static void setPrecisionSafetyMargin(int precisionSafetyMargin);
 
+	/**
+	 * @brief Getter function for the maximal number of released mpf_t values whose limbs are kept for reuse by each thread.
+	 *
+	 * @return The currently stored maximal number of cached released mpf_t values. The value -1 stands for no limit.
+	 */
+	static int getMaximalCachedReleasedMpftValues();
+
+	/**
+	 * @brief Setter function for the maximal number of released mpf_t values whose limbs are kept for reuse by each thread.
+	 *
+	 * If a thread releases further values then their limbs are freed immediately.
+	 *
+	 * @param maximalCachedReleasedMpftValues The new maximal number of cached released mpf_t values. The value -1 stands for no limit.
+	 */
+	static void setMaximalCachedReleasedMpftValues(int maximalCachedReleasedMpftValues);
+
+	/**
+	 * @brief Getter function for the maximal number of bytes of limbs of released mpf_t values kept for reuse by each thread.
+	 *
+	 * @return The currently stored maximal number of bytes. The value -1 stands for no limit.
+	 */
+	static long long getMaximalCachedReleasedMpftLimbBytes();
+
+	/**
+	 * @brief Setter function for the maximal number of bytes of limbs of released mpf_t values kept for reuse by each thread.
+	 *
+	 * If a thread releases further values then their limbs are freed immediately.
+	 *
+	 * @param maximalCachedReleasedMpftLimbBytes The new maximal number of bytes. The value -1 stands for no limit.
+	 */
+	static void setMaximalCachedReleasedMpftLimbBytes(long long maximalCachedReleasedMpftLimbBytes);
+
+	/**
+	 * @brief Getter function for the algorithm which calculates sine and cosine.
+	 *
+	 * @return The current trigonometric algorithm.
+	 */
+	static arbitraryprecisioncalculation::configuration::TrigonometricAlgorithm getTrigonometricAlgorithm();
+
+	/**
+	 * @brief Setter function for the algorithm which calculates sine and cosine.
+	 *
+	 * @param trigonometricAlgorithm The new trigonometric algorithm.
+	 */
+	static void setTrigonometricAlgorithm(
+			arbitraryprecisioncalculation::configuration::TrigonometricAlgorithm trigonometricAlgorithm);
+
+	/**
+	 * @brief Getter function for the precision from which on the automatic trigonometric algorithm uses the CORDIC algorithm.
+	 *
+	 * @return The current CORDIC minimal precision in bits. The value ULONG_MAX stands for never.
+	 */
+	static unsigned long getCordicMinimalPrecision();
+
+	/**
+	 * @brief Setter function for the precision from which on the automatic trigonometric algorithm uses the CORDIC algorithm.
+	 *
+	 * @param cordicMinimalPrecision The new CORDIC minimal precision in bits. The value ULONG_MAX stands for never.
+	 */
+	static void setCordicMinimalPrecision(unsigned long cordicMinimalPrecision);
+
+	/**
+	 * @brief Getter function for the algorithm which calculates the natural logarithm.
+	 *
+	 * @return The current logarithm algorithm.
+	 */
+	static arbitraryprecisioncalculation::configuration::LogarithmAlgorithm getLogarithmAlgorithm();
+
+	/**
+	 * @brief Setter function for the algorithm which calculates the natural logarithm.
+	 *
+	 * @param logarithmAlgorithm The new logarithm algorithm.
+	 */
+	static void setLogarithmAlgorithm(
+			arbitraryprecisioncalculation::configuration::LogarithmAlgorithm logarithmAlgorithm);
+
+	/**
+	 * @brief Getter function for the precision from which on the automatic logarithm algorithm uses the arithmetic-geometric mean.
+	 *
+	 * @return The current AGM minimal precision in bits. The value ULONG_MAX stands for never.
+	 */
+	static unsigned long getLogAgmMinimalPrecision();
+
+	/**
+	 * @brief Setter function for the precision from which on the automatic logarithm algorithm uses the arithmetic-geometric mean.
+	 *
+	 * @param logAgmMinimalPrecision The new AGM minimal precision in bits. The value ULONG_MAX stands for never.
+	 */
+	static void setLogAgmMinimalPrecision(unsigned long logAgmMinimalPrecision);
+
+	/**
+	 * @brief Stores the algorithm selection, i.e. the algorithms and the precisions from which on the automatic selections switch.
+	 *
+	 * A profile which was determined by mpftoperations::TuneAlgorithms can be stored and loaded by later runs on the same host.
+	 *
+	 * @param output_stream The stream which receives the algorithm selection.
+	 */
+	static void StoreAlgorithmProfile(std::ofstream* output_stream);
+
+	/**
+	 * @brief Loads an algorithm selection which was stored by StoreAlgorithmProfile.
+	 *
+	 * @param input_stream The stream which supplies the algorithm selection.
+	 */
+	static void LoadAlgorithmProfile(std::ifstream* input_stream);
+
 	/**
 	 * @brief Getter function for the standard random number generator.
 	 *
 	 * @return The currently stored standard random number generator.
+	 * It is shared by all threads and not synchronized.
 	 */
 	static RandomNumberGenerator* getStandardRandomNumberGenerator();
 
@@ -215,7 +445,23 @@ private:
 	/**
 	* @brief Specifies whether the precision will be increased shortly.
 	*/
-	static bool increase_precision_recommended_;
+	static std::atomic<bool> increase_precision_recommended_;
+	/**
+	* @brief Stores the maximal needed precision which was recorded since the last reset (0 if none was recorded).
+	*/
+	static std::atomic<unsigned long> recommended_precision_;
+	/**
+	* @brief Specifies how IncreasePrecision determines the new precision.
+	*/
+	static arbitraryprecisioncalculation::configuration::PrecisionGrowthStrategy precision_growth_strategy_;
+	/**
+	* @brief Specifies the factor of the geometric precision growth strategy.
+	*/
+	static double precision_growth_factor_;
+	/**
+	* @brief Specifies the maximal number of threads which calculate constants like pi.
+	*/
+	static int constant_calculation_threads_;
 
 	/**
 	* @brief Specifies the number of digits for the output of mpf_t values while using printing functions.
@@ -223,6 +469,32 @@ private:
 	*/
 	static int output_precision_;
 
+	/**
+	* @brief Specifies the maximal number of released mpf_t values whose limbs are kept by each thread (-1 for no limit).
+	*/
+	static int maximal_cached_released_mpft_values_;
+	/**
+	* @brief Specifies the maximal number of bytes of limbs of released mpf_t values kept by each thread (-1 for no limit).
+	*/
+	static long long maximal_cached_released_mpft_limb_bytes_;
+
+	/**
+	* @brief Specifies the algorithm which calculates sine and cosine.
+	*/
+	static arbitraryprecisioncalculation::configuration::TrigonometricAlgorithm trigonometric_algorithm_;
+	/**
+	* @brief Specifies the precision from which on the automatic trigonometric algorithm uses the CORDIC algorithm (ULONG_MAX for never).
+	*/
+	static unsigned long cordic_minimal_precision_;
+	/**
+	* @brief Specifies the algorithm which calculates the natural logarithm.
+	*/
+	static arbitraryprecisioncalculation::configuration::LogarithmAlgorithm logarithm_algorithm_;
+	/**
+	* @brief Specifies the precision from which on the automatic logarithm algorithm uses the arithmetic-geometric mean (ULONG_MAX for never).
+	*/
+	static unsigned long log_agm_minimal_precision_;
+
 	/**
 	* @brief Specifies the random number generator for the particle swarm optimization algorithm.
 	*/
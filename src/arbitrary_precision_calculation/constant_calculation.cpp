@@ -0,0 +1,496 @@
+/**
+* @file   arbitrary_precision_calculation/constant_calculation.cpp
+* @author Alexander Raß (alexander.rass@fau.de)
+* @date   October, 2026
+* @brief  This file contains the algorithms which calculate mathematical constants.
+*
+* @copyright
+* This project is released under the MIT License (MIT).
+*
+* @copyright
+* The MIT License (MIT)
+*
+* @copyright
+* Copyright (c) 2016 by Friedrich-Alexander-Universität Erlangen-Nürnberg and
+* Alexander Raß
+*
+* @copyright
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* @copyright
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* @copyright
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "arbitrary_precision_calculation/constant_calculation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "arbitrary_precision_calculation/check_condition.h"
+#include "arbitrary_precision_calculation/operations.h"
+
+namespace arbitraryprecisioncalculation {
+namespace constantcalculation {
+
+namespace {
+
+// constants of the Chudnovsky series
+// 1 / pi = 12 / 640320^(3/2) * sum_k (-1)^k (6k)! (13591409 + 545140134 k) / ((3k)! (k!)^3 640320^(3k))
+const unsigned long CHUDNOVSKY_A = 13591409UL;
+const unsigned long CHUDNOVSKY_B = 545140134UL;
+// 640320^3 / 24
+const unsigned long CHUDNOVSKY_C3_OVER_24 = 10939058860032000UL;
+// each term adds log2(640320^3 / 1728) bits
+const double CHUDNOVSKY_BITS_PER_TERM = 47.11;
+// smaller ranges of terms are not split between threads
+const long PARALLEL_MINIMAL_TERMS = 1024;
+
+// P, Q and T of a range of terms (see chudnovskySplit).
+struct SplitResult {
+	mpz_t p;
+	mpz_t q;
+	mpz_t t;
+	SplitResult() {
+		mpz_init(p);
+		mpz_init(q);
+		mpz_init(t);
+	}
+	~SplitResult() {
+		mpz_clear(p);
+		mpz_clear(q);
+		mpz_clear(t);
+	}
+	SplitResult(const SplitResult &) = delete;
+	SplitResult & operator=(const SplitResult &) = delete;
+};
+
+// Appends the terms of right to the terms of result, where the terms of right directly follow the terms of result.
+void chudnovskyMerge(SplitResult* result, SplitResult* right, bool need_p) {
+	// T = T_left * Q_right + P_left * T_right
+	mpz_mul(result->t, result->t, right->q);
+	mpz_mul(right->t, result->p, right->t);
+	mpz_add(result->t, result->t, right->t);
+	mpz_mul(result->q, result->q, right->q);
+	if (need_p) {
+		mpz_mul(result->p, result->p, right->p);
+	}
+}
+
+// Evaluates the terms a, ..., b - 1 of the Chudnovsky series by binary splitting such that
+// sum of these terms = T / Q (relative to the product of the factors of the terms before a).
+// P is only needed for the left parts of merges, hence it is omitted if need_p is false.
+void chudnovskySplit(long a, long b, SplitResult* result, bool need_p, int threads) {
+	if (b - a == 1) {
+		if (a == 0) {
+			mpz_set_ui(result->p, 1);
+			mpz_set_ui(result->q, 1);
+		} else {
+			mpz_set_ui(result->p, 6 * a - 5);
+			mpz_mul_ui(result->p, result->p, 2 * a - 1);
+			mpz_mul_ui(result->p, result->p, 6 * a - 1);
+			mpz_set_ui(result->q, a);
+			mpz_mul_ui(result->q, result->q, a);
+			mpz_mul_ui(result->q, result->q, a);
+			mpz_mul_ui(result->q, result->q, CHUDNOVSKY_C3_OVER_24);
+		}
+		mpz_mul_ui(result->t, result->p, CHUDNOVSKY_A + CHUDNOVSKY_B * a);
+		if (a % 2 == 1) mpz_neg(result->t, result->t);
+		return;
+	}
+	long m = (a + b) / 2;
+	SplitResult right;
+	if (threads > 1 && b - a >= PARALLEL_MINIMAL_TERMS) {
+		std::thread left_thread(chudnovskySplit, a, m, result, true, threads / 2);
+		chudnovskySplit(m, b, &right, need_p, threads - threads / 2);
+		left_thread.join();
+	} else {
+		chudnovskySplit(a, m, result, true, 1);
+		chudnovskySplit(m, b, &right, need_p, 1);
+	}
+	chudnovskyMerge(result, &right, need_p);
+}
+
+// Appends the terms of right to the terms of result (see chudnovskyMerge) for the series of e.
+void eMerge(SplitResult* result, SplitResult* right) {
+	// T = T_left * Q_right + T_right
+	mpz_mul(result->t, result->t, right->q);
+	mpz_add(result->t, result->t, right->t);
+	mpz_mul(result->q, result->q, right->q);
+}
+
+// Evaluates the terms a, ..., b - 1 of e = sum_n 1 / n! by binary splitting such that
+// sum of these terms = T / Q (relative to the factor 1 / max(a - 1, 0)! of the terms before a).
+// P is always 1 and therefore not used.
+void eSplit(long a, long b, SplitResult* result) {
+	if (b - a == 1) {
+		mpz_set_ui(result->q, std::max(a, 1L));
+		mpz_set_ui(result->t, 1);
+		return;
+	}
+	long m = (a + b) / 2;
+	SplitResult right;
+	eSplit(a, m, result);
+	eSplit(m, b, &right);
+	eMerge(result, &right);
+}
+
+// P, Q, B and T of a range of terms of the series atanh(p/q) (see atanhSplit).
+struct AtanhSplitResult {
+	mpz_t p;
+	mpz_t q;
+	mpz_t b;
+	mpz_t t;
+	AtanhSplitResult() {
+		mpz_init(p);
+		mpz_init(q);
+		mpz_init(b);
+		mpz_init(t);
+	}
+	~AtanhSplitResult() {
+		mpz_clear(p);
+		mpz_clear(q);
+		mpz_clear(b);
+		mpz_clear(t);
+	}
+	AtanhSplitResult(const AtanhSplitResult &) = delete;
+	AtanhSplitResult & operator=(const AtanhSplitResult &) = delete;
+};
+
+// Appends the terms of right to the terms of result (see chudnovskyMerge) for the series of atanh.
+void atanhMerge(AtanhSplitResult* result, AtanhSplitResult* right) {
+	// T = T_left * B_right * Q_right + B_left * P_left * T_right
+	mpz_mul(result->t, result->t, right->b);
+	mpz_mul(result->t, result->t, right->q);
+	mpz_mul(right->t, result->p, right->t);
+	mpz_mul(right->t, result->b, right->t);
+	mpz_add(result->t, result->t, right->t);
+	mpz_mul(result->p, result->p, right->p);
+	mpz_mul(result->q, result->q, right->q);
+	mpz_mul(result->b, result->b, right->b);
+}
+
+// Evaluates the terms a, ..., b - 1 of atanh(x / y) = sum_k x^(2k + 1) / ((2k + 1) y^(2k + 1)) by binary splitting such that
+// sum of these terms = T / (B * Q) (relative to the powers of x / y of the terms before a).
+void atanhSplit(unsigned long x, unsigned long y, long a, long b, AtanhSplitResult* result) {
+	if (b - a == 1) {
+		mpz_set_ui(result->p, x);
+		mpz_set_ui(result->q, y);
+		if (a > 0) {
+			mpz_mul_ui(result->p, result->p, x);
+			mpz_mul_ui(result->q, result->q, y);
+		}
+		mpz_set_ui(result->b, 2 * a + 1);
+		mpz_set(result->t, result->p);
+		return;
+	}
+	long m = (a + b) / 2;
+	AtanhSplitResult right;
+	atanhSplit(x, y, a, m, result);
+	atanhSplit(x, y, m, b, &right);
+	atanhMerge(result, &right);
+}
+
+// The terms 0, ..., terms - 1 of a series evaluated by binary splitting.
+// The sum can be extended by further terms if P is kept.
+template <class Result>
+struct SeriesSum {
+	SeriesSum() : terms(0) {}
+	long terms;
+	Result result;
+};
+
+// Extends the sum of the Chudnovsky series to the specified number of terms.
+void extendChudnovsky(SeriesSum<SplitResult>* sum, long terms, bool need_p, int threads) {
+	if (terms <= sum->terms) return;
+	if (sum->terms == 0) {
+		chudnovskySplit(0, terms, &sum->result, need_p, threads);
+	} else {
+		SplitResult right;
+		chudnovskySplit(sum->terms, terms, &right, need_p, threads);
+		chudnovskyMerge(&sum->result, &right, need_p);
+	}
+	sum->terms = terms;
+}
+
+// Extends the sum of the series of e to the specified number of terms.
+void extendE(SeriesSum<SplitResult>* sum, long terms) {
+	if (terms <= sum->terms) return;
+	if (sum->terms == 0) {
+		eSplit(0, terms, &sum->result);
+	} else {
+		SplitResult right;
+		eSplit(sum->terms, terms, &right);
+		eMerge(&sum->result, &right);
+	}
+	sum->terms = terms;
+}
+
+// Extends the sum of the series of atanh(x / y) to the specified number of terms.
+void extendAtanh(unsigned long x, unsigned long y, SeriesSum<AtanhSplitResult>* sum, long terms) {
+	if (terms <= sum->terms) return;
+	if (sum->terms == 0) {
+		atanhSplit(x, y, 0, terms, &sum->result);
+	} else {
+		AtanhSplitResult right;
+		atanhSplit(x, y, sum->terms, terms, &right);
+		atanhMerge(&sum->result, &right);
+	}
+	sum->terms = terms;
+}
+
+// The sums kept by the incremental calculations, such that a higher precision only evaluates the additional terms.
+// The sums of atanh are kept for each ratio x / y.
+std::mutex kept_pi_mutex_;
+SeriesSum<SplitResult> kept_pi_;
+std::mutex kept_e_mutex_;
+SeriesSum<SplitResult> kept_e_;
+std::mutex kept_atanh_mutex_;
+std::map<std::pair<unsigned long, unsigned long>, SeriesSum<AtanhSplitResult> > kept_atanh_;
+
+// Calculates atanh(x / y) for 0 < x < y with the given precision into res.
+// If keep_terms is set the kept sum of the series is extended, otherwise the series is evaluated anew.
+void atanhRational(unsigned long x, unsigned long y, mp_bitcnt_t precision, mpf_t res, bool keep_terms) {
+	long terms = (long)(precision / (2.0 * std::log2((double)y / x))) + 2;
+	SeriesSum<AtanhSplitResult> local_sum;
+	SeriesSum<AtanhSplitResult>* sum = &local_sum;
+	std::unique_lock<std::mutex> lock(kept_atanh_mutex_, std::defer_lock);
+	if (keep_terms) {
+		lock.lock();
+		sum = &kept_atanh_[std::make_pair(x, y)];
+	}
+	extendAtanh(x, y, sum, terms);
+	// atanh(x / y) = T / (B * Q)
+	mpz_t denominator_z;
+	mpz_init(denominator_z);
+	mpz_mul(denominator_z, sum->result.b, sum->result.q);
+	mpf_t denominator;
+	mpf_init2(denominator, precision);
+	mpf_set_z(res, sum->result.t);
+	mpf_set_z(denominator, denominator_z);
+	mpf_div(res, res, denominator);
+	mpf_clear(denominator);
+	mpz_clear(denominator_z);
+}
+
+// Calculates pi with the Chudnovsky series.
+// If keep_terms is set the kept sum of the series is extended, otherwise the series is evaluated anew.
+mpf_t* calculatePi(int threads, mp_bitcnt_t result_precision, bool keep_terms) {
+	mp_bitcnt_t precision = result_precision + GMP_NUMB_BITS;
+	long terms = (long)(precision / CHUDNOVSKY_BITS_PER_TERM) + 2;
+	SeriesSum<SplitResult> local_sum;
+	SeriesSum<SplitResult>* sum = &local_sum;
+	std::unique_lock<std::mutex> lock(kept_pi_mutex_, std::defer_lock);
+	if (keep_terms) {
+		lock.lock();
+		sum = &kept_pi_;
+	}
+	// P of all terms is only needed for later extensions
+	extendChudnovsky(sum, terms, keep_terms, std::max(threads, 1));
+	// pi = 426880 * sqrt(10005) * Q / T
+	mpf_t numerator;
+	mpf_t denominator;
+	mpf_init2(numerator, precision);
+	mpf_init2(denominator, precision);
+	mpf_sqrt_ui(numerator, 10005);
+	mpf_set_z(denominator, sum->result.q);
+	mpf_mul(numerator, numerator, denominator);
+	mpf_mul_ui(numerator, numerator, 426880);
+	mpf_set_z(denominator, sum->result.t);
+	mpf_t* res = mpftoperations::GetResultPointer(result_precision);
+	mpf_div(*res, numerator, denominator);
+	mpf_clear(numerator);
+	mpf_clear(denominator);
+	return res;
+}
+
+// Calculates e with the series of 1 / n! (see calculatePi for keep_terms).
+mpf_t* calculateE(mp_bitcnt_t precision, bool keep_terms) {
+	mp_bitcnt_t working_precision = precision + GMP_NUMB_BITS;
+	// the remaining terms after the term 1 / n! sum up to less than 1 / n!
+	long terms = 2;
+	double log2_factorial = 0.0;
+	while (log2_factorial < working_precision) {
+		log2_factorial += std::log2((double)terms);
+		terms++;
+	}
+	SeriesSum<SplitResult> local_sum;
+	SeriesSum<SplitResult>* sum = &local_sum;
+	std::unique_lock<std::mutex> lock(kept_e_mutex_, std::defer_lock);
+	if (keep_terms) {
+		lock.lock();
+		sum = &kept_e_;
+	}
+	extendE(sum, terms);
+	mpf_t numerator;
+	mpf_t denominator;
+	mpf_init2(numerator, working_precision);
+	mpf_init2(denominator, working_precision);
+	mpf_set_z(numerator, sum->result.t);
+	mpf_set_z(denominator, sum->result.q);
+	mpf_t* res = mpftoperations::GetResultPointer(precision);
+	mpf_div(*res, numerator, denominator);
+	mpf_clear(numerator);
+	mpf_clear(denominator);
+	return res;
+}
+
+// Calculates ln(2) = 18 atanh(1/26) - 2 atanh(1/4801) + 8 atanh(1/8749) (see calculatePi for keep_terms).
+mpf_t* calculateLn2(mp_bitcnt_t precision, bool keep_terms) {
+	mp_bitcnt_t working_precision = precision + GMP_NUMB_BITS;
+	mpf_t term;
+	mpf_t sum;
+	mpf_init2(term, working_precision);
+	mpf_init2(sum, working_precision);
+	atanhRational(1, 26, working_precision, term, keep_terms);
+	mpf_mul_ui(sum, term, 18);
+	atanhRational(1, 4801, working_precision, term, keep_terms);
+	mpf_mul_ui(term, term, 2);
+	mpf_sub(sum, sum, term);
+	atanhRational(1, 8749, working_precision, term, keep_terms);
+	mpf_mul_ui(term, term, 8);
+	mpf_add(sum, sum, term);
+	mpf_t* res = mpftoperations::GetResultPointer(precision);
+	mpf_set(*res, sum);
+	mpf_clear(term);
+	mpf_clear(sum);
+	return res;
+}
+
+// Calculates ln(numerator / denominator) (see calculatePi for keep_terms).
+mpf_t* calculateLogRatio(unsigned long numerator, unsigned long denominator, mp_bitcnt_t precision, bool keep_terms) {
+	AssertCondition(numerator > 0 && denominator > 0, "The logarithm is only defined for positive ratios.");
+	mpf_t* res = mpftoperations::GetResultPointer(precision);
+	if (numerator == denominator) {
+		return res;
+	}
+	// ln(n / d) = 2 atanh((n - d) / (n + d))
+	mp_bitcnt_t working_precision = precision + GMP_NUMB_BITS;
+	mpf_t value;
+	mpf_init2(value, working_precision);
+	if (numerator > denominator) {
+		atanhRational(numerator - denominator, numerator + denominator, working_precision, value, keep_terms);
+	} else {
+		atanhRational(denominator - numerator, numerator + denominator, working_precision, value, keep_terms);
+		mpf_neg(value, value);
+	}
+	mpf_mul_2exp(*res, value, 1);
+	mpf_clear(value);
+	return res;
+}
+
+} // namespace
+
+mpf_t* CalculatePiChudnovsky(int threads) {
+	return CalculatePiChudnovsky(threads, mpf_get_default_prec());
+}
+
+mpf_t* CalculatePiChudnovsky(int threads, mp_bitcnt_t precision) {
+	return calculatePi(threads, precision, false);
+}
+
+mpf_t* CalculatePiChudnovskyIncrementally(int threads, mp_bitcnt_t precision) {
+	return calculatePi(threads, precision, true);
+}
+
+mpf_t* CalculatePiBaileyBorweinPlouffe(){
+	mpf_t* n16 = mpftoperations::ToMpft(16.0);
+	mpf_t* n8 = mpftoperations::ToMpft(8.0);
+	mpf_t* n6 = mpftoperations::ToMpft(6.0);
+	mpf_t* n5 = mpftoperations::ToMpft(5.0);
+	mpf_t* n4 = mpftoperations::ToMpft(4.0);
+	mpf_t* n2 = mpftoperations::ToMpft(2.0);
+	mpf_t* n1 = mpftoperations::ToMpft(1.0);
+	mpf_t* n0 = mpftoperations::ToMpft(0.0);
+	mpf_t* n1d16 = mpftoperations::Divide(n1, n16);
+	mpf_t* mul = mpftoperations::Clone(n1);
+	mpf_t* k8 = mpftoperations::Clone(n0);
+	mpf_t* res = mpftoperations::Clone(n0);
+	mpf_t* d = NULL;
+	mpf_t* t1 = NULL;
+	mpf_t* t2 = NULL;
+	mpf_t* t3 = NULL;
+	mpf_t* t4 = NULL;
+	// the term k is below 16^-k 4 / (8k + 1), hence the terms k >= K sum up to less than 16^-K for K >= 1
+	unsigned long terms = mpf_get_default_prec() / 4 + 2;
+	for(unsigned long k = 0; k < terms; k++){
+		d = mpftoperations::AddNoCheck(d, k8, n1);
+		t1 = mpftoperations::Divide(t1, n4, d);
+		d = mpftoperations::AddNoCheck(d, k8, n4);
+		t2 = mpftoperations::Divide(t2, n2, d);
+		d = mpftoperations::AddNoCheck(d, k8, n5);
+		t3 = mpftoperations::Divide(t3, n1, d);
+		d = mpftoperations::AddNoCheck(d, k8, n6);
+		t4 = mpftoperations::Divide(t4, n1, d);
+		t1 = mpftoperations::SubtractNoCheck(t1, t1, t2);
+		t1 = mpftoperations::SubtractNoCheck(t1, t1, t3);
+		t1 = mpftoperations::SubtractNoCheck(t1, t1, t4);
+		t1 = mpftoperations::Multiply(t1, t1, mul);
+		res = mpftoperations::AddNoCheck(res, res, t1);
+		k8 = mpftoperations::AddNoCheck(k8, k8, n8);
+		mul = mpftoperations::Multiply(mul, mul, n1d16);
+	}
+	mpftoperations::ReleaseValue(d);
+	mpftoperations::ReleaseValue(t1);
+	mpftoperations::ReleaseValue(t2);
+	mpftoperations::ReleaseValue(t3);
+	mpftoperations::ReleaseValue(t4);
+	mpftoperations::ReleaseValue(n16);
+	mpftoperations::ReleaseValue(n8);
+	mpftoperations::ReleaseValue(n6);
+	mpftoperations::ReleaseValue(n5);
+	mpftoperations::ReleaseValue(n4);
+	mpftoperations::ReleaseValue(n2);
+	mpftoperations::ReleaseValue(n1);
+	mpftoperations::ReleaseValue(n0);
+	mpftoperations::ReleaseValue(n1d16);
+	mpftoperations::ReleaseValue(mul);
+	mpftoperations::ReleaseValue(k8);
+	return res;
+}
+
+mpf_t* CalculateE(mp_bitcnt_t precision) {
+	return calculateE(precision, false);
+}
+
+mpf_t* CalculateEIncrementally(mp_bitcnt_t precision) {
+	return calculateE(precision, true);
+}
+
+mpf_t* CalculateLn2(mp_bitcnt_t precision) {
+	return calculateLn2(precision, false);
+}
+
+mpf_t* CalculateLn2Incrementally(mp_bitcnt_t precision) {
+	return calculateLn2(precision, true);
+}
+
+mpf_t* CalculateLogRatio(unsigned long numerator, unsigned long denominator, mp_bitcnt_t precision) {
+	return calculateLogRatio(numerator, denominator, precision, false);
+}
+
+mpf_t* CalculateLogRatioIncrementally(unsigned long numerator, unsigned long denominator, mp_bitcnt_t precision) {
+	return calculateLogRatio(numerator, denominator, precision, true);
+}
+
+} // namespace constantcalculation
+} // namespace arbitraryprecisioncalculation
@@ -0,0 +1,170 @@
+/**
+* @file   arbitrary_precision_calculation/constant_calculation.h
+* @author Alexander Raß (alexander.rass@fau.de)
+* @date   October, 2026
+* @brief  This file contains the algorithms which calculate mathematical constants.
+*
+* @copyright
+* This project is released under the MIT License (MIT).
+*
+* @copyright
+* The MIT License (MIT)
+*
+* @copyright
+* Copyright (c) 2016 by Friedrich-Alexander-Universität Erlangen-Nürnberg and
+* Alexander Raß
+*
+* @copyright
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* @copyright
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* @copyright
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#ifndef ARBITRARY_PRECISION_CALCULATION_CONSTANT_CALCULATION_H_
+#define ARBITRARY_PRECISION_CALCULATION_CONSTANT_CALCULATION_H_
+
+#include <gmp.h>
+
+namespace arbitraryprecisioncalculation {
+
+/**
+* @brief Contains the algorithms which calculate mathematical constants with the current precision.
+*
+* The functions calculate the constants anew on each call.
+* The incremental variants keep the evaluated terms of their series for the whole program,
+* such that a later call with a higher precision only evaluates the additional terms.
+* Usually mpftoperations::GetPi should be used, which caches the constant for the current precision.
+*/
+namespace constantcalculation {
+
+/**
+* @brief Calculates pi with the Chudnovsky series.
+*
+* The series is evaluated by binary splitting on integers (mpz_t),
+* afterwards one square root and one division of floating point numbers remain.
+* If more than one thread is allowed and the precision is large then both halves of the upper splitting levels are evaluated in parallel.
+*
+* @param threads The maximal number of threads used for the calculation.
+*
+* @return Pi with the current precision.
+*/
+mpf_t* CalculatePiChudnovsky(int threads);
+
+/**
+* @brief Calculates pi with the Chudnovsky series and the specified precision.
+*
+* @param threads The maximal number of threads used for the calculation.
+* @param precision The precision of the result in bits.
+*
+* @return Pi with the specified precision.
+*/
+mpf_t* CalculatePiChudnovsky(int threads, mp_bitcnt_t precision);
+
+/**
+* @brief Calculates pi with the Chudnovsky series and keeps the evaluated terms for later calls.
+*
+* @param threads The maximal number of threads used for the evaluation of additional terms.
+* @param precision The precision of the result in bits.
+*
+* @return Pi with the specified precision.
+*/
+mpf_t* CalculatePiChudnovskyIncrementally(int threads, mp_bitcnt_t precision);
+
+/**
+* @brief Calculates pi with the Bailey-Borwein-Plouffe formula.
+*
+* Each term needs four divisions with full precision. This function is kept for comparison.
+*
+* @return Pi with the current precision.
+*/
+mpf_t* CalculatePiBaileyBorweinPlouffe();
+
+/**
+* @brief Calculates Euler's number e.
+*
+* Uses e = sum_n 1 / n!, where the series is evaluated by binary splitting on integers (mpz_t).
+*
+* @param precision The precision of the result in bits.
+*
+* @return e with the specified precision.
+*/
+mpf_t* CalculateE(mp_bitcnt_t precision);
+
+/**
+* @brief Calculates Euler's number e and keeps the evaluated terms for later calls.
+*
+* @param precision The precision of the result in bits.
+*
+* @return e with the specified precision.
+*/
+mpf_t* CalculateEIncrementally(mp_bitcnt_t precision);
+
+/**
+* @brief Calculates the natural logarithm of 2.
+*
+* Uses ln(2) = 18 atanh(1/26) - 2 atanh(1/4801) + 8 atanh(1/8749),
+* where each series is evaluated by binary splitting on integers (mpz_t).
+*
+* @param precision The precision of the result in bits.
+*
+* @return ln(2) with the specified precision.
+*/
+mpf_t* CalculateLn2(mp_bitcnt_t precision);
+
+/**
+* @brief Calculates the natural logarithm of 2 and keeps the evaluated terms for later calls.
+*
+* @param precision The precision of the result in bits.
+*
+* @return ln(2) with the specified precision.
+*/
+mpf_t* CalculateLn2Incrementally(mp_bitcnt_t precision);
+
+/**
+* @brief Calculates the natural logarithm of a ratio of two positive integers.
+*
+* Uses ln(n / d) = 2 atanh((n - d) / (n + d)), where the series is evaluated by binary splitting on integers (mpz_t).
+* The series converges fast if n and d are close to each other.
+*
+* @param numerator The numerator n of the ratio.
+* @param denominator The denominator d of the ratio.
+* @param precision The precision of the result in bits.
+*
+* @return ln(n / d) with the specified precision.
+*/
+mpf_t* CalculateLogRatio(unsigned long numerator, unsigned long denominator, mp_bitcnt_t precision);
+
+/**
+* @brief Calculates the natural logarithm of a ratio of two positive integers and keeps the evaluated terms for later calls.
+*
+* The terms are kept separately for each ratio.
+*
+* @param numerator The numerator n of the ratio.
+* @param denominator The denominator d of the ratio.
+* @param precision The precision of the result in bits.
+*
+* @return ln(n / d) with the specified precision.
+*/
+mpf_t* CalculateLogRatioIncrementally(unsigned long numerator, unsigned long denominator, mp_bitcnt_t precision);
+
+} // namespace constantcalculation
+} // namespace arbitraryprecisioncalculation
+
+#endif /* ARBITRARY_PRECISION_CALCULATION_CONSTANT_CALCULATION_H_ */
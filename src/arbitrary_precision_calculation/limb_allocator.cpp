@@ -0,0 +1,347 @@
+/**
+* @file   arbitrary_precision_calculation/limb_allocator.cpp
+* @author Alexander Raß (alexander.rass@fau.de)
+* @date   October, 2026
+* @brief  This file contains an optional allocator for the limbs of gmp.
+*
+* @copyright
+* This project is released under the MIT License (MIT).
+*
+* @copyright
+* The MIT License (MIT)
+*
+* @copyright
+* Copyright (c) 2016 by Friedrich-Alexander-Universität Erlangen-Nürnberg and
+* Alexander Raß
+*
+* @copyright
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* @copyright
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* @copyright
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "arbitrary_precision_calculation/limb_allocator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <gmp.h>
+#include <mutex>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <vector>
+
+#include "arbitrary_precision_calculation/check_condition.h"
+#include "arbitrary_precision_calculation/mpft_pool.h"
+
+namespace arbitraryprecisioncalculation {
+
+struct LimbBlock {
+	// next block in the free list
+	LimbBlock* next;
+};
+
+namespace {
+
+// size of a chunk in bytes. Equal to the size of a huge page on x86-64.
+const size_t CHUNK_SIZE = 1 << 21;
+// the smallest size class is 2^MINIMAL_CLASS_EXPONENT bytes
+const int MINIMAL_CLASS_EXPONENT = 5;
+// the largest size class is 2^MAXIMAL_CLASS_EXPONENT bytes
+const int MAXIMAL_CLASS_EXPONENT = 20;
+const int CLASSES_PER_POWER_OF_TWO = 4;
+const int NUMBER_OF_CLASSES = (MAXIMAL_CLASS_EXPONENT - MINIMAL_CLASS_EXPONENT) * CLASSES_PER_POWER_OF_TWO + 1;
+const size_t MAXIMAL_CLASS_SIZE = (size_t)1 << MAXIMAL_CLASS_EXPONENT;
+// number of bytes which are moved at once between the cache of a thread and the global free lists
+const size_t BATCH_BYTES = 1 << 16;
+
+static_assert(MAXIMAL_CLASS_SIZE <= CHUNK_SIZE, "The largest size class does not fit into a chunk.");
+
+// Size classes are 2^k + j * 2^(k-2) for j = 1, ..., 4. Hence all sizes are multiples of 8
+// and the rounding wastes less than 25 percent.
+inline int sizeClass(size_t size) {
+	if (size <= ((size_t)1 << MINIMAL_CLASS_EXPONENT)) return 0;
+	int exponent = 63 - __builtin_clzll((unsigned long long)(size - 1));
+	size_t step = (size_t)1 << (exponent - 2);
+	int sub_class = (int)((size - ((size_t)1 << exponent) + step - 1) >> (exponent - 2));
+	return (exponent - MINIMAL_CLASS_EXPONENT) * CLASSES_PER_POWER_OF_TWO + sub_class;
+}
+
+inline size_t classSize(int size_class) {
+	if (size_class == 0) return (size_t)1 << MINIMAL_CLASS_EXPONENT;
+	int exponent = MINIMAL_CLASS_EXPONENT + (size_class - 1) / CLASSES_PER_POWER_OF_TWO;
+	int sub_class = (size_class - 1) % CLASSES_PER_POWER_OF_TWO + 1;
+	return ((size_t)1 << exponent) + sub_class * ((size_t)1 << (exponent - 2));
+}
+
+inline int batchCount(int size_class) {
+	return std::max(1, (int)(BATCH_BYTES / classSize(size_class)));
+}
+
+std::atomic<bool> installed_(false);
+bool use_huge_pages_ = false;
+
+// memory functions of gmp before the installation, used for large requests
+void* (*previous_allocate_)(size_t) = NULL;
+void* (*previous_reallocate_)(void*, size_t, size_t) = NULL;
+void (*previous_free_)(void*, size_t) = NULL;
+
+// global free lists and the current chunk (guarded by global_mutex_)
+std::mutex global_mutex_;
+LimbBlock* global_free_lists_[NUMBER_OF_CLASSES];
+char* chunk_position_ = NULL;
+char* chunk_end_ = NULL;
+std::atomic<long long> bytes_reserved_(0);
+
+// bytes in use of finished threads and of allocations without a local cache
+std::atomic<long long> bytes_in_use_without_cache_(0);
+
+char* mapChunk() {
+	if (!use_huge_pages_) {
+		void* chunk = mmap(NULL, CHUNK_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		AssertCondition(chunk != MAP_FAILED, "Chunk for limbs could not be mapped.");
+		return static_cast<char*>(chunk);
+	}
+	// huge pages have to be aligned to their size, hence twice the size is mapped and the rest is unmapped
+	void* mapping = mmap(NULL, 2 * CHUNK_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	AssertCondition(mapping != MAP_FAILED, "Chunk for limbs could not be mapped.");
+	uintptr_t start = reinterpret_cast<uintptr_t>(mapping);
+	uintptr_t aligned = (start + CHUNK_SIZE - 1) & ~(uintptr_t)(CHUNK_SIZE - 1);
+	if (aligned > start) munmap(mapping, aligned - start);
+	if (aligned + CHUNK_SIZE < start + 2 * CHUNK_SIZE) {
+		munmap(reinterpret_cast<void*>(aligned + CHUNK_SIZE), start + CHUNK_SIZE - aligned);
+	}
+#ifdef MADV_HUGEPAGE
+	// only a hint, if transparent huge pages are disabled the chunk is backed by normal pages
+	madvise(reinterpret_cast<void*>(aligned), CHUNK_SIZE, MADV_HUGEPAGE);
+#endif
+	return reinterpret_cast<char*>(aligned);
+}
+
+} // namespace
+
+// free blocks of a thread for each size class
+struct LimbCache {
+	LimbBlock* free_lists[NUMBER_OF_CLASSES];
+	int counts[NUMBER_OF_CLASSES];
+	// only modified by the owning thread, read by GetBytesInUse
+	std::atomic<long long> bytes_in_use;
+	LimbCache() : bytes_in_use(0) {
+		for (int i = 0; i < NUMBER_OF_CLASSES; i++) {
+			free_lists[i] = NULL;
+			counts[i] = 0;
+		}
+	}
+	inline void addBytes(long long bytes) {
+		bytes_in_use.store(bytes_in_use.load(std::memory_order_relaxed) + bytes, std::memory_order_relaxed);
+	}
+};
+
+namespace {
+
+thread_local LimbCache* local_cache_ = NULL;
+thread_local bool local_cache_destroyed_ = false;
+
+// all caches which currently exist (guarded by global_mutex_)
+std::vector<LimbCache*> & caches() {
+	// the vector is never destroyed such that gmp values can be freed during static destruction
+	static std::vector<LimbCache*>* caches = new std::vector<LimbCache*>();
+	return *caches;
+}
+
+// Destroys the cache of a thread when the thread finishes.
+struct LocalCacheGuard {
+	~LocalCacheGuard() {
+		LimbCache* cache = local_cache_;
+		local_cache_ = NULL;
+		local_cache_destroyed_ = true;
+		if (cache == NULL) return;
+		std::lock_guard<std::mutex> lock(global_mutex_);
+		for (int i = 0; i < NUMBER_OF_CLASSES; i++) {
+			while (cache->free_lists[i] != NULL) {
+				LimbBlock* block = cache->free_lists[i];
+				cache->free_lists[i] = block->next;
+				block->next = global_free_lists_[i];
+				global_free_lists_[i] = block;
+			}
+		}
+		bytes_in_use_without_cache_ += cache->bytes_in_use.load();
+		std::vector<LimbCache*> & all = caches();
+		all.erase(std::find(all.begin(), all.end(), cache));
+		delete cache;
+	}
+};
+
+LimbCache* localCache() {
+	if (local_cache_ != NULL || local_cache_destroyed_) return local_cache_;
+	static thread_local LocalCacheGuard guard;
+	local_cache_ = new LimbCache();
+	std::lock_guard<std::mutex> lock(global_mutex_);
+	caches().push_back(local_cache_);
+	return local_cache_;
+}
+
+} // namespace
+
+void LimbAllocator::Install(bool use_huge_pages) {
+	if (installed_) return;
+	AssertCondition(MpftPool::GetNumberOfReservedValues() == 0, "The limb allocator has to be installed before any mpf_t is initialized.");
+	use_huge_pages_ = use_huge_pages;
+	mp_get_memory_functions(&previous_allocate_, &previous_reallocate_, &previous_free_);
+	installed_ = true;
+	mp_set_memory_functions(Allocate, Reallocate, Free);
+}
+
+bool LimbAllocator::IsInstalled() {
+	return installed_;
+}
+
+long long LimbAllocator::GetBytesInUse() {
+	std::lock_guard<std::mutex> lock(global_mutex_);
+	long long result = bytes_in_use_without_cache_;
+	for (unsigned int i = 0; i < caches().size(); i++) {
+		result += caches()[i]->bytes_in_use.load(std::memory_order_relaxed);
+	}
+	return result;
+}
+
+long long LimbAllocator::GetBytesReserved() {
+	return bytes_reserved_;
+}
+
+size_t LimbAllocator::GetAllocationSize(size_t size) {
+	if (size > MAXIMAL_CLASS_SIZE) return size;
+	return classSize(sizeClass(size));
+}
+
+LimbBlock* LimbAllocator::Refill(int size_class, int batch, int* count) {
+	size_t size = classSize(size_class);
+	std::lock_guard<std::mutex> lock(global_mutex_);
+	LimbBlock* first = global_free_lists_[size_class];
+	if (first != NULL) {
+		LimbBlock* last = first;
+		*count = 1;
+		while (*count < batch && last->next != NULL) {
+			last = last->next;
+			++*count;
+		}
+		global_free_lists_[size_class] = last->next;
+		last->next = NULL;
+		return first;
+	}
+	if ((size_t)(chunk_end_ - chunk_position_) < size) {
+		// the rest of the current chunk is wasted, it is smaller than the largest size class
+		chunk_position_ = mapChunk();
+		chunk_end_ = chunk_position_ + CHUNK_SIZE;
+		bytes_reserved_ += CHUNK_SIZE;
+	}
+	*count = std::min(batch, (int)((chunk_end_ - chunk_position_) / size));
+	first = reinterpret_cast<LimbBlock*>(chunk_position_);
+	for (int i = 0; i < *count; i++) {
+		LimbBlock* block = reinterpret_cast<LimbBlock*>(chunk_position_);
+		chunk_position_ += size;
+		block->next = (i + 1 < *count) ? reinterpret_cast<LimbBlock*>(chunk_position_) : NULL;
+	}
+	return first;
+}
+
+void LimbAllocator::Flush(int size_class, LimbBlock* first, LimbBlock* last) {
+	std::lock_guard<std::mutex> lock(global_mutex_);
+	last->next = global_free_lists_[size_class];
+	global_free_lists_[size_class] = first;
+}
+
+void* LimbAllocator::Allocate(size_t size) {
+	LimbCache* cache = localCache();
+	if (size > MAXIMAL_CLASS_SIZE) {
+		void* result = previous_allocate_(size);
+		if (cache != NULL) cache->addBytes(size);
+		else bytes_in_use_without_cache_ += size;
+		return result;
+	}
+	int size_class = sizeClass(size);
+	if (cache == NULL) {
+		// the thread is finishing, hence the global free lists are used
+		int count;
+		LimbBlock* block = Refill(size_class, 1, &count);
+		bytes_in_use_without_cache_ += classSize(size_class);
+		return block;
+	}
+	LimbBlock* block = cache->free_lists[size_class];
+	if (block == NULL) {
+		block = Refill(size_class, batchCount(size_class), &cache->counts[size_class]);
+	}
+	cache->free_lists[size_class] = block->next;
+	--cache->counts[size_class];
+	cache->addBytes(classSize(size_class));
+	return block;
+}
+
+void* LimbAllocator::Reallocate(void* ptr, size_t old_size, size_t new_size) {
+	if (old_size > MAXIMAL_CLASS_SIZE && new_size > MAXIMAL_CLASS_SIZE) {
+		void* result = previous_reallocate_(ptr, old_size, new_size);
+		LimbCache* cache = localCache();
+		if (cache != NULL) cache->addBytes((long long)new_size - (long long)old_size);
+		else bytes_in_use_without_cache_ += (long long)new_size - (long long)old_size;
+		return result;
+	}
+	if (old_size <= MAXIMAL_CLASS_SIZE && new_size <= MAXIMAL_CLASS_SIZE && sizeClass(old_size) == sizeClass(new_size)) {
+		return ptr;
+	}
+	void* result = Allocate(new_size);
+	memcpy(result, ptr, std::min(old_size, new_size));
+	Free(ptr, old_size);
+	return result;
+}
+
+void LimbAllocator::Free(void* ptr, size_t size) {
+	LimbCache* cache = localCache();
+	if (size > MAXIMAL_CLASS_SIZE) {
+		previous_free_(ptr, size);
+		if (cache != NULL) cache->addBytes(-(long long)size);
+		else bytes_in_use_without_cache_ -= size;
+		return;
+	}
+	int size_class = sizeClass(size);
+	LimbBlock* block = static_cast<LimbBlock*>(ptr);
+	if (cache == NULL) {
+		block->next = NULL;
+		Flush(size_class, block, block);
+		bytes_in_use_without_cache_ -= classSize(size_class);
+		return;
+	}
+	block->next = cache->free_lists[size_class];
+	cache->free_lists[size_class] = block;
+	cache->addBytes(-(long long)classSize(size_class));
+	int batch = batchCount(size_class);
+	if (++cache->counts[size_class] >= 2 * batch) {
+		// hands the blocks behind the first batch to the other threads
+		LimbBlock* last = block;
+		for (int i = 1; i < batch; i++) last = last->next;
+		LimbBlock* first = last->next;
+		LimbBlock* end = first;
+		for (int i = 1; i < cache->counts[size_class] - batch; i++) end = end->next;
+		last->next = NULL;
+		Flush(size_class, first, end);
+		cache->counts[size_class] = batch;
+	}
+}
+
+} // namespace arbitraryprecisioncalculation
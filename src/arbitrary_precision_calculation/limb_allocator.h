@@ -0,0 +1,111 @@
+/**
+* @file   arbitrary_precision_calculation/limb_allocator.h
+* @author Alexander Raß (alexander.rass@fau.de)
+* @date   October, 2026
+* @brief  This file contains an optional allocator for the limbs of gmp.
+*
+* @copyright
+* This project is released under the MIT License (MIT).
+*
+* @copyright
+* The MIT License (MIT)
+*
+* @copyright
+* Copyright (c) 2016 by Friedrich-Alexander-Universität Erlangen-Nürnberg and
+* Alexander Raß
+*
+* @copyright
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* @copyright
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* @copyright
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#ifndef ARBITRARY_PRECISION_CALCULATION_LIMB_ALLOCATOR_H_
+#define ARBITRARY_PRECISION_CALCULATION_LIMB_ALLOCATOR_H_
+
+#include <cstddef>
+
+namespace arbitraryprecisioncalculation {
+
+struct LimbBlock;
+
+/**
+* @brief Supplies the memory of all allocations of gmp (limbs of mpf_t values and temporary memory of gmp functions).
+*
+* The allocator is optional and has to be installed by LimbAllocator::Install before any gmp value is initialized.
+* Requests are rounded up to size classes (four classes per power of two between 32 bytes and 1 MiB).
+* Each thread keeps a free list for each size class, hence allocations and frees usually need no synchronization.
+* Blocks are carved from chunks of 2 MiB which are obtained by mmap and optionally backed by transparent huge pages.
+* Larger requests are forwarded to the memory functions of gmp which were active before the installation.
+* Memory of chunks is kept for reuse and never returned to the operating system.
+*/
+class LimbAllocator{
+public:
+	/**
+	* @brief Installs the allocator with mp_set_memory_functions.
+	*
+	* Has to be called before any gmp value is initialized, because gmp frees memory with the functions which are currently installed.
+	* Subsequent calls have no effect.
+	*
+	* @param use_huge_pages Specifies whether chunks should be backed by transparent huge pages (madvise with MADV_HUGEPAGE).
+	*/
+	static void Install(bool use_huge_pages);
+	/**
+	* @brief Checks whether the allocator is installed.
+	*
+	* @return True if and only if the allocator is installed.
+	*/
+	static bool IsInstalled();
+	/**
+	* @brief Getter function for the number of bytes which are currently allocated by gmp through this allocator.
+	*
+	* The size of each allocation is rounded up to its size class.
+	*
+	* @return The number of bytes in use.
+	*/
+	static long long GetBytesInUse();
+	/**
+	* @brief Getter function for the number of bytes which are obtained from the operating system for the chunks.
+	*
+	* @return The number of bytes of all chunks.
+	*/
+	static long long GetBytesReserved();
+	/**
+	* @brief Getter function for the size of the size class which is used for allocations of the given size.
+	*
+	* @param size The requested size in bytes.
+	*
+	* @return The size of the size class in bytes or the supplied size if it exceeds the largest size class.
+	*/
+	static size_t GetAllocationSize(size_t size);
+
+private:
+	static void* Allocate(size_t size);
+	static void* Reallocate(void* ptr, size_t old_size, size_t new_size);
+	static void Free(void* ptr, size_t size);
+	// Takes at most batch blocks of the given class from the global free list or the current chunk.
+	static LimbBlock* Refill(int size_class, int batch, int* count);
+	// Moves all blocks of the list from first to last to the global free list of the given class.
+	static void Flush(int size_class, LimbBlock* first, LimbBlock* last);
+};
+
+} // namespace arbitraryprecisioncalculation
+
+#endif /* ARBITRARY_PRECISION_CALCULATION_LIMB_ALLOCATOR_H_ */
@@ -0,0 +1,592 @@
+/**
+* @file   arbitrary_precision_calculation/mpft_pool.cpp
+* @author Alexander Raß (alexander.rass@fau.de)
+* @date   October, 2026
+* @brief  This file contains the pool which supplies the memory of all mpf_t values.
+*
+* @copyright
+* This project is released under the MIT License (MIT).
+*
+* @copyright
+* The MIT License (MIT)
+*
+* @copyright
+* Copyright (c) 2016 by Friedrich-Alexander-Universität Erlangen-Nürnberg and
+* Alexander Raß
+*
+* @copyright
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* @copyright
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* @copyright
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "arbitrary_precision_calculation/mpft_pool.h"
+
+#include <algorithm>
+#include <mutex>
+#include <new>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "arbitrary_precision_calculation/check_condition.h"
+#include "arbitrary_precision_calculation/configuration.h"
+
+namespace arbitraryprecisioncalculation {
+
+// size of a slab in bytes. Has to be a power of two, because slabs are aligned
+// to their size such that the slab of a slot can be found by masking its address.
+const size_t SLAB_SIZE = 1 << 14;
+
+struct MpftSlot {
+	// has to be the first member such that mpf_t* and MpftSlot* can be converted into each other.
+	// If no limbs are attached then _mp_d is NULL.
+	mpf_t value;
+	// next slot in the free list if the slot is not in use
+	MpftSlot* next;
+};
+
+const int BITS_PER_WORD = 64;
+const int IN_USE_WORDS = SLAB_SIZE / sizeof(MpftSlot) / BITS_PER_WORD;
+const int SLOTS_PER_SLAB = (SLAB_SIZE - sizeof(MpftSlab*) - IN_USE_WORDS * sizeof(std::atomic<unsigned long long>)) / sizeof(MpftSlot);
+
+struct MpftSlab {
+	MpftSlab* next;
+	// bit i is set if and only if slot i is currently in use.
+	// Slots of the same slab may be used by different threads.
+	std::atomic<unsigned long long> in_use[IN_USE_WORDS];
+	MpftSlot slots[SLOTS_PER_SLAB];
+};
+
+static_assert(sizeof(MpftSlab) <= SLAB_SIZE, "Slab header and slots do not fit into a slab.");
+static_assert(SLOTS_PER_SLAB <= IN_USE_WORDS * BITS_PER_WORD, "Not enough in use bits for all slots of a slab.");
+
+namespace {
+
+// number of released values which are moved at once between the pool of a thread and the depot
+const int BATCH_SIZE = 64;
+// maximal number of batches in the depot
+const int DEPOT_BATCHES = 64;
+
+// The depot is lock free. Each entry is either NULL or a list of released values.
+// Entries are only filled if they are NULL and emptied by an exchange with NULL,
+// hence no ABA problem can occur.
+std::atomic<MpftSlot*> depot_[DEPOT_BATCHES];
+std::atomic<int> depot_batches_(0);
+
+// all slabs which are allocated (guarded by slabs_mutex_)
+std::mutex slabs_mutex_;
+MpftSlab* slabs_ = NULL;
+int number_of_slabs_ = 0;
+
+std::mutex pools_mutex_;
+int values_in_use_of_finished_threads_ = 0;
+
+std::mutex shared_pool_mutex_;
+
+// number of open arenas of all threads. Their logs may reference released slots of any pool or of the depot,
+// hence no slab is freed while an arena is open.
+std::atomic<int> open_arenas_of_all_pools_(0);
+
+// Kinds of the marks for the next pointer of slots in use, which are owned by an arena (see MpftPool::ArenaMark).
+const int ARENA_OWNED = 0;
+const int ARENA_PROMOTED = 1;
+const int ARENA_KEPT = 2;
+
+thread_local MpftPool* local_pool_ = NULL;
+thread_local bool local_pool_destroyed_ = false;
+
+// Number of bytes allocated for the limbs of an mpf_t with the given precision (compare mpf_init2).
+inline long long limbBytes(mp_size_t limbs) {
+	return (limbs + 1) * (long long) sizeof(mp_limb_t);
+}
+
+inline MpftSlab* slabOf(MpftSlot* slot) {
+	return reinterpret_cast<MpftSlab*>(reinterpret_cast<uintptr_t>(slot) & ~(uintptr_t)(SLAB_SIZE - 1));
+}
+
+#if ARBITRARY_PRECISION_CALCULATION_CHECK_MULTIPLE_FREES
+// Toggles the in use bit of the slot and returns whether it was set before.
+inline bool toggleInUse(MpftSlot* slot) {
+	MpftSlab* slab = slabOf(slot);
+	int index = slot - slab->slots;
+	unsigned long long bit = 1ULL << (index % BITS_PER_WORD);
+	return (slab->in_use[index / BITS_PER_WORD].fetch_xor(bit, std::memory_order_relaxed) & bit) != 0;
+}
+#endif
+
+// all pools which currently exist (guarded by pools_mutex_)
+std::vector<MpftPool*> & pools() {
+	// the vector is never destroyed such that pools can be destroyed during static destruction
+	static std::vector<MpftPool*>* pools = new std::vector<MpftPool*>();
+	return *pools;
+}
+
+inline void changeValuesInUse(std::atomic<int> & values_in_use, int change) {
+	// only one thread writes the value at a time hence no atomic read-modify-write is necessary
+	values_in_use.store(values_in_use.load(std::memory_order_relaxed) + change, std::memory_order_relaxed);
+}
+
+bool pushToDepot(MpftSlot* batch) {
+	for (int i = 0; i < DEPOT_BATCHES; i++) {
+		MpftSlot* expected = NULL;
+		if (depot_[i].load(std::memory_order_relaxed) == NULL
+				&& depot_[i].compare_exchange_strong(expected, batch, std::memory_order_release, std::memory_order_relaxed)) {
+			depot_batches_.fetch_add(1, std::memory_order_relaxed);
+			return true;
+		}
+	}
+	return false;
+}
+
+MpftSlot* popFromDepot() {
+	if (depot_batches_.load(std::memory_order_relaxed) <= 0) return NULL;
+	for (int i = 0; i < DEPOT_BATCHES; i++) {
+		if (depot_[i].load(std::memory_order_relaxed) != NULL) {
+			MpftSlot* batch = depot_[i].exchange(NULL, std::memory_order_acquire);
+			if (batch != NULL) {
+				depot_batches_.fetch_sub(1, std::memory_order_relaxed);
+				return batch;
+			}
+		}
+	}
+	return NULL;
+}
+
+MpftSlab* allocateSlab() {
+	void* memory = NULL;
+	AssertCondition(posix_memalign(&memory, SLAB_SIZE, SLAB_SIZE) == 0, "Allocation of memory for mpf_t values failed.");
+	MpftSlab* slab = new (memory) MpftSlab;
+	for (int i = 0; i < IN_USE_WORDS; i++) {
+		slab->in_use[i].store(0ULL, std::memory_order_relaxed);
+	}
+	for (int i = 0; i < SLOTS_PER_SLAB; i++) {
+		slab->slots[i].value->_mp_d = NULL;
+	}
+	std::lock_guard<std::mutex> lock(slabs_mutex_);
+	slab->next = slabs_;
+	slabs_ = slab;
+	++number_of_slabs_;
+	return slab;
+}
+
+void freeSlab(MpftSlab* slab) {
+	{
+		std::lock_guard<std::mutex> lock(slabs_mutex_);
+		MpftSlab** link = &slabs_;
+		while (*link != slab) {
+			link = &((*link)->next);
+		}
+		*link = slab->next;
+		--number_of_slabs_;
+	}
+	slab->~MpftSlab();
+	free(slab);
+}
+
+// Frees the limbs of the released slot.
+inline void clearLimbs(MpftSlot* slot) {
+	mpf_clear(slot->value);
+	slot->value->_mp_d = NULL;
+}
+
+// Values in the depot are not counted by the limits of any pool,
+// hence their limbs are freed before they enter the depot if a limit is configured.
+void clearLimbsIfLimited(MpftSlot* batch) {
+	if (Configuration::getMaximalCachedReleasedMpftValues() < 0 && Configuration::getMaximalCachedReleasedMpftLimbBytes() < 0) return;
+	for (MpftSlot* slot = batch; slot != NULL; slot = slot->next) {
+		if (slot->value->_mp_d != NULL) {
+			clearLimbs(slot);
+		}
+	}
+}
+
+} // namespace
+
+MpftPool::MpftPool() :
+		free_lists_(1, FreeList{0, NULL, 0}),
+		current_free_list_(0),
+		slots_without_limbs_(NULL),
+		cached_values_(0),
+		cached_limb_bytes_(0),
+		values_in_use_(0),
+		open_arenas_(0) {
+	std::lock_guard<std::mutex> lock(pools_mutex_);
+	pools().push_back(this);
+}
+
+MpftPool::LocalPoolGuard::~LocalPoolGuard() {
+	MpftPool* pool = local_pool_;
+	local_pool_ = NULL;
+	local_pool_destroyed_ = true;
+	pool->Flush();
+	// arenas which are still open at the end of the thread are discarded with the pool
+	open_arenas_of_all_pools_.fetch_sub(pool->open_arenas_, std::memory_order_relaxed);
+	std::lock_guard<std::mutex> lock(pools_mutex_);
+	values_in_use_of_finished_threads_ += pool->values_in_use_.load(std::memory_order_relaxed);
+	pools().erase(std::find(pools().begin(), pools().end(), pool));
+	delete pool;
+}
+
+mpf_t* MpftPool::AcquireValue(mp_bitcnt_t precision) {
+	MpftPool* pool = Local();
+	if (pool != NULL) {
+		return pool->Acquire(precision);
+	}
+	std::lock_guard<std::mutex> lock(shared_pool_mutex_);
+	return Shared()->Acquire(precision);
+}
+
+void MpftPool::ReleaseValue(mpf_t* value) {
+	MpftPool* pool = Local();
+	if (pool != NULL) {
+		pool->Release(value);
+		return;
+	}
+	std::lock_guard<std::mutex> lock(shared_pool_mutex_);
+	Shared()->Release(value);
+}
+
+int MpftPool::GetNumberOfValuesInUse() {
+	std::lock_guard<std::mutex> lock(pools_mutex_);
+	int res = values_in_use_of_finished_threads_;
+	for (unsigned int i = 0; i < pools().size(); i++) {
+		res += pools()[i]->values_in_use_.load(std::memory_order_relaxed);
+	}
+	return res;
+}
+
+void MpftPool::PrepareLocalPool() {
+	if (local_pool_ != NULL || local_pool_destroyed_) return;
+	static thread_local LocalPoolGuard guard;
+	(void) &guard;
+	local_pool_ = new MpftPool();
+}
+
+MpftPool* MpftPool::Local() {
+	if (local_pool_ == NULL) {
+		PrepareLocalPool();
+	}
+	return local_pool_;
+}
+
+MpftPool* MpftPool::Shared() {
+	// the pool is never destroyed such that mpf_t values can be released during static destruction
+	static MpftPool* pool = new MpftPool();
+	return pool;
+}
+
+size_t MpftPool::OpenArena() {
+	MpftPool* pool = Local();
+	AssertCondition(pool != NULL, "Arenas are not available after the end of the thread.");
+	++pool->open_arenas_;
+	open_arenas_of_all_pools_.fetch_add(1, std::memory_order_relaxed);
+	return pool->arena_log_.size();
+}
+
+void MpftPool::CloseArena(size_t watermark) {
+	MpftPool* pool = Local();
+	AssertCondition(pool != NULL && pool->open_arenas_ > 0 && watermark <= pool->arena_log_.size(), "Arenas have to be closed in reverse order of opening.");
+	std::vector<MpftSlot*> & log = pool->arena_log_;
+	--pool->open_arenas_;
+	open_arenas_of_all_pools_.fetch_sub(1, std::memory_order_relaxed);
+	// a slot can occur several times if it was released and acquired again,
+	// but only the last acquisition can still be marked
+	size_t kept = watermark;
+	for (size_t i = watermark; i < log.size(); i++) {
+		MpftSlot* slot = log[i];
+		if (slot->next == pool->ArenaMark(ARENA_OWNED)) {
+			pool->ReleaseSlot(slot);
+		} else if (slot->next == pool->ArenaMark(ARENA_PROMOTED)) {
+			if (pool->open_arenas_ > 0) {
+				slot->next = pool->ArenaMark(ARENA_KEPT);
+				log[kept++] = slot;
+			} else {
+				slot->next = NULL;
+			}
+		}
+	}
+	log.resize(kept);
+	// promoted slots are owned by the enclosing arena from now on
+	for (size_t i = watermark; i < kept; i++) {
+		log[i]->next = pool->ArenaMark(ARENA_OWNED);
+	}
+}
+
+MpftSlot* MpftPool::ArenaMark(int kind) {
+	return reinterpret_cast<MpftSlot*>(arena_marks_ + kind);
+}
+
+void MpftPool::PromoteValue(mpf_t* value) {
+	MpftSlot* slot = reinterpret_cast<MpftSlot*>(value);
+	MpftPool* pool = Local();
+	if (pool != NULL && slot->next == pool->ArenaMark(ARENA_OWNED)) {
+		slot->next = pool->ArenaMark(ARENA_PROMOTED);
+	}
+}
+
+int MpftPool::SuspendArenas() {
+	MpftPool* pool = Local();
+	if (pool == NULL) return 0;
+	int arenas = pool->open_arenas_;
+	pool->open_arenas_ = 0;
+	return arenas;
+}
+
+void MpftPool::ResumeArenas(int arenas) {
+	MpftPool* pool = Local();
+	if (pool == NULL) return;
+	AssertCondition(pool->open_arenas_ == 0, "Arenas have to be closed before the suspended arenas are resumed.");
+	pool->open_arenas_ = arenas;
+}
+
+mpf_t* MpftPool::Acquire(mp_bitcnt_t precision) {
+	mp_size_t limbs = PrecisionInLimbs(precision);
+	if (free_lists_[current_free_list_].limbs != limbs) {
+		current_free_list_ = FindFreeList(limbs);
+	}
+	MpftSlot* slot = free_lists_[current_free_list_].first;
+	if (slot == NULL && TakeBatchFromDepot()) {
+		current_free_list_ = FindFreeList(limbs);
+		slot = free_lists_[current_free_list_].first;
+	}
+	if (slot != NULL) {
+		// reuse the limbs, only the value has to be reset (compare mpf_init)
+		Pop(free_lists_[current_free_list_]);
+		slot->value->_mp_size = 0;
+		slot->value->_mp_exp = 0;
+	} else {
+		// no limbs of matching size available then prefer to resize limbs
+		// of a different precision rather than allocating new limbs
+		for (unsigned int i = 0; i < free_lists_.size() && slot == NULL; i++) {
+			slot = free_lists_[i].first;
+			if (slot != NULL) {
+				Pop(free_lists_[i]);
+				mpf_set_prec(slot->value, precision);
+				mpf_set_ui(slot->value, 0);
+			}
+		}
+		if (slot == NULL) {
+			if (slots_without_limbs_ == NULL) {
+				MpftSlab* slab = allocateSlab();
+				for (int i = SLOTS_PER_SLAB - 1; i >= 0; i--) {
+					slab->slots[i].next = slots_without_limbs_;
+					slots_without_limbs_ = slab->slots + i;
+				}
+			}
+			slot = slots_without_limbs_;
+			slots_without_limbs_ = slot->next;
+			mpf_init2(slot->value, precision);
+		}
+	}
+#if ARBITRARY_PRECISION_CALCULATION_CHECK_MULTIPLE_FREES
+	AssertCondition(!toggleInUse(slot), "Internal Error. New generated mpf_t pointer is not valid.");
+#endif
+	changeValuesInUse(values_in_use_, 1);
+	if (open_arenas_ > 0) {
+		slot->next = ArenaMark(ARENA_OWNED);
+		arena_log_.push_back(slot);
+	}
+	return &(slot->value);
+}
+
+void MpftPool::Release(mpf_t* value) {
+	ReleaseSlot(reinterpret_cast<MpftSlot*>(value));
+}
+
+void MpftPool::ReleaseSlot(MpftSlot* slot) {
+#if ARBITRARY_PRECISION_CALCULATION_CHECK_MULTIPLE_FREES
+	AssertCondition(toggleInUse(slot), "Multiple frees on same mpf_t.");
+#endif
+	changeValuesInUse(values_in_use_, -1);
+	InsertWithinLimits(slot);
+	FreeList & list = free_lists_[current_free_list_];
+	if (list.size > 2 * BATCH_SIZE) {
+		// hand surplus values to other threads
+		MpftSlot* last = list.first;
+		for (int i = 1; i < BATCH_SIZE; i++) {
+			last = last->next;
+		}
+		MpftSlot* batch = list.first;
+		MpftSlot* remaining = last->next;
+		last->next = NULL;
+		if (pushToDepot(batch)) {
+			list.first = remaining;
+			list.size -= BATCH_SIZE;
+			cached_values_ -= BATCH_SIZE;
+			cached_limb_bytes_ -= BATCH_SIZE * limbBytes(list.limbs);
+			clearLimbsIfLimited(batch);
+		} else {
+			last->next = remaining;
+		}
+	}
+}
+
+void MpftPool::Flush() {
+	std::vector<MpftSlot*> slots;
+	for (unsigned int i = 0; i < free_lists_.size(); i++) {
+		for (MpftSlot* slot = free_lists_[i].first; slot != NULL; slot = slot->next) {
+			slots.push_back(slot);
+		}
+		free_lists_[i].first = NULL;
+		free_lists_[i].size = 0;
+	}
+	for (MpftSlot* slot = slots_without_limbs_; slot != NULL; slot = slot->next) {
+		slots.push_back(slot);
+	}
+	slots_without_limbs_ = NULL;
+	cached_values_ = 0;
+	cached_limb_bytes_ = 0;
+	for (unsigned int begin = 0; begin < slots.size(); begin += BATCH_SIZE) {
+		unsigned int end = std::min(begin + BATCH_SIZE, (unsigned int) slots.size());
+		for (unsigned int i = begin; i + 1 < end; i++) {
+			slots[i]->next = slots[i + 1];
+		}
+		slots[end - 1]->next = NULL;
+		clearLimbsIfLimited(slots[begin]);
+		if (!pushToDepot(slots[begin])) {
+			// the depot is full, keep the values in the shared pool
+			std::lock_guard<std::mutex> lock(shared_pool_mutex_);
+			MpftPool* shared = Shared();
+			for (unsigned int i = begin; i < end; i++) {
+				shared->InsertWithinLimits(slots[i]);
+			}
+		}
+	}
+}
+
+void MpftPool::Insert(MpftSlot* slot) {
+	if (slot->value->_mp_d == NULL) {
+		slot->next = slots_without_limbs_;
+		slots_without_limbs_ = slot;
+		return;
+	}
+	if (free_lists_[current_free_list_].limbs != slot->value->_mp_prec) {
+		current_free_list_ = FindFreeList(slot->value->_mp_prec);
+	}
+	FreeList & list = free_lists_[current_free_list_];
+	slot->next = list.first;
+	list.first = slot;
+	++list.size;
+	++cached_values_;
+	cached_limb_bytes_ += limbBytes(list.limbs);
+}
+
+void MpftPool::InsertWithinLimits(MpftSlot* slot) {
+	// the limbs are kept such that they can be reused by the next acquire of the same precision
+	// unless the configured limits are exceeded
+	if (slot->value->_mp_d != NULL) {
+		int maximal_values = Configuration::getMaximalCachedReleasedMpftValues();
+		long long maximal_limb_bytes = Configuration::getMaximalCachedReleasedMpftLimbBytes();
+		if ((maximal_values >= 0 && cached_values_ >= maximal_values)
+				|| (maximal_limb_bytes >= 0 && cached_limb_bytes_ + limbBytes(slot->value->_mp_prec) > maximal_limb_bytes)) {
+			clearLimbs(slot);
+		}
+	}
+	Insert(slot);
+}
+
+MpftSlot* MpftPool::Pop(FreeList & list) {
+	MpftSlot* slot = list.first;
+	list.first = slot->next;
+	--list.size;
+	--cached_values_;
+	cached_limb_bytes_ -= limbBytes(list.limbs);
+	return slot;
+}
+
+void MpftPool::Trim() {
+	MpftPool* pool = Local();
+	if (pool != NULL) {
+		// values in the depot are not used by any thread
+		while (pool->TakeBatchFromDepot()) {}
+	}
+	// the logs of open arenas may reference released slots, also of other threads
+	bool free_slabs = (open_arenas_of_all_pools_.load(std::memory_order_relaxed) == 0);
+	if (pool != NULL) {
+		pool->TrimReleasedValues(free_slabs);
+	}
+	std::lock_guard<std::mutex> lock(shared_pool_mutex_);
+	Shared()->TrimReleasedValues(free_slabs);
+}
+
+int MpftPool::GetNumberOfReservedValues() {
+	std::lock_guard<std::mutex> lock(slabs_mutex_);
+	return number_of_slabs_ * SLOTS_PER_SLAB;
+}
+
+void MpftPool::TrimReleasedValues(bool free_slabs) {
+	std::vector<MpftSlot*> slots;
+	for (unsigned int i = 0; i < free_lists_.size(); i++) {
+		for (MpftSlot* slot = free_lists_[i].first; slot != NULL; slot = slot->next) {
+			clearLimbs(slot);
+			slots.push_back(slot);
+		}
+	}
+	free_lists_.assign(1, FreeList{0, NULL, 0});
+	current_free_list_ = 0;
+	cached_values_ = 0;
+	cached_limb_bytes_ = 0;
+	for (MpftSlot* slot = slots_without_limbs_; slot != NULL; slot = slot->next) {
+		slots.push_back(slot);
+	}
+	// a slab can be freed if all of its slots are released to this pool,
+	// because then no other thread or pool references any of them
+	std::sort(slots.begin(), slots.end());
+	slots_without_limbs_ = NULL;
+	for (unsigned int begin = 0, end = 0; begin < slots.size(); begin = end) {
+		MpftSlab* slab = slabOf(slots[begin]);
+		while (end < slots.size() && slabOf(slots[end]) == slab) {
+			end++;
+		}
+		if (free_slabs && (int)(end - begin) == SLOTS_PER_SLAB) {
+			freeSlab(slab);
+		} else {
+			for (unsigned int i = begin; i < end; i++) {
+				slots[i]->next = slots_without_limbs_;
+				slots_without_limbs_ = slots[i];
+			}
+		}
+	}
+}
+
+bool MpftPool::TakeBatchFromDepot() {
+	MpftSlot* batch = popFromDepot();
+	if (batch == NULL) return false;
+	while (batch != NULL) {
+		MpftSlot* next = batch->next;
+		InsertWithinLimits(batch);
+		batch = next;
+	}
+	return true;
+}
+
+int MpftPool::FindFreeList(mp_size_t limbs) {
+	for (unsigned int i = 0; i < free_lists_.size(); i++) {
+		if (free_lists_[i].limbs == limbs) return i;
+	}
+	// empty free lists of other precisions are removed such that the search stays short
+	free_lists_.erase(std::remove_if(free_lists_.begin(), free_lists_.end(),
+				[](const FreeList & list) { return list.first == NULL; }),
+			free_lists_.end());
+	free_lists_.push_back(FreeList{limbs, NULL, 0});
+	return free_lists_.size() - 1;
+}
+
+} // namespace arbitraryprecisioncalculation
@@ -0,0 +1,316 @@
+/**
+* @file   arbitrary_precision_calculation/mpft_pool.h
+* @author Alexander Raß (alexander.rass@fau.de)
+* @date   October, 2026
+* @brief  This file contains the pool which supplies the memory of all mpf_t values.
+*
+* @copyright
+* This project is released under the MIT License (MIT).
+*
+* @copyright
+* The MIT License (MIT)
+*
+* @copyright
+* Copyright (c) 2016 by Friedrich-Alexander-Universität Erlangen-Nürnberg and
+* Alexander Raß
+*
+* @copyright
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* @copyright
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* @copyright
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#ifndef ARBITRARY_PRECISION_CALCULATION_MPFT_POOL_H_
+#define ARBITRARY_PRECISION_CALCULATION_MPFT_POOL_H_
+
+#include <atomic>
+#include <gmp.h>
+#include <vector>
+
+// If ARBITRARY_PRECISION_CALCULATION_CHECK_MULTIPLE_FREES is set to one then
+// each release of an mpf_t checks whether the mpf_t is currently in use.
+// If it is set to zero then this check is completely removed (see target release in the makefile).
+#ifndef ARBITRARY_PRECISION_CALCULATION_CHECK_MULTIPLE_FREES
+#define ARBITRARY_PRECISION_CALCULATION_CHECK_MULTIPLE_FREES 1
+#endif
+
+namespace arbitraryprecisioncalculation {
+
+struct MpftSlot;
+struct MpftSlab;
+
+/**
+* @brief Supplies the memory for mpf_t values.
+*
+* The mpf_t values are stored in slabs of fixed size.
+* Each slab starts with a header, which contains a bit for each slot whether it is currently in use.
+* Released mpf_t values keep their limbs and are linked into an intrusive free list of their precision.
+* Therefore acquiring and releasing an mpf_t takes constant time and usually no memory allocation is necessary.
+*
+* Each thread uses its own pool without any synchronization.
+* A thread which releases many more values than it acquires hands batches of released values
+* to a depot shared by all threads. Threads which run out of released values take batches from the depot.
+* Values can be released by any thread, not only by the thread which acquired them.
+*/
+class MpftPool{
+public:
+	/**
+	* @brief Supplies an mpf_t with value zero and the specified precision from the pool of the current thread.
+	*
+	* @param precision The precision in bits.
+	*
+	* @return The pointer to the prepared mpf_t.
+	*/
+	static mpf_t* AcquireValue(mp_bitcnt_t precision);
+	/**
+	* @brief Releases the supplied mpf_t to the pool of the current thread.
+	*
+	* @param value The supplied mpf_t. It has to be acquired from a pool.
+	*/
+	static void ReleaseValue(mpf_t* value);
+	/**
+	* @brief Getter function for the number of mpf_t values which are currently in use by all threads.
+	*
+	* @return The number of mpf_t values in use.
+	*/
+	static int GetNumberOfValuesInUse();
+	/**
+	* @brief Ensures that the pool of the current thread exists.
+	*
+	* Thread local objects which release mpf_t values in their destructor should call this function
+	* before they are constructed. Then the pool is destructed after these objects.
+	*/
+	static void PrepareLocalPool();
+	/**
+	* @brief Calculates the precision in limbs of an mpf_t initialized with the given number of bits (compare mpf_init2).
+	*
+	* @param precision The precision in bits.
+	*
+	* @return The precision in limbs.
+	*/
+	static inline mp_size_t PrecisionInLimbs(mp_bitcnt_t precision) {
+		return (mp_size_t)(((precision < 53 ? 53 : precision) + 2 * GMP_NUMB_BITS - 1) / GMP_NUMB_BITS);
+	}
+	/**
+	* @brief Opens an arena of the current thread. All values acquired by this thread until the arena
+	* is closed are owned by the arena.
+	*
+	* @return The watermark of the arena, which has to be supplied to CloseArena.
+	*/
+	static size_t OpenArena();
+	/**
+	* @brief Closes the most recently opened arena of the current thread and releases all values owned by it.
+	*
+	* Values which were already released are skipped. Promoted values are handed to the enclosing arena if one exists.
+	*
+	* @param watermark The watermark returned by OpenArena.
+	*/
+	static void CloseArena(size_t watermark);
+	/**
+	* @brief Excludes the value from the release when the current arena is closed.
+	*
+	* @param value The value which was acquired by the current thread.
+	*/
+	static void PromoteValue(mpf_t* value);
+	/**
+	* @brief Suspends all arenas of the current thread. Values acquired afterwards are not owned by any arena.
+	*
+	* @return The number of suspended arenas, which has to be supplied to ResumeArenas.
+	*/
+	static int SuspendArenas();
+	/**
+	* @brief Resumes the arenas which were suspended by SuspendArenas.
+	*
+	* @param arenas The number of suspended arenas.
+	*/
+	static void ResumeArenas(int arenas);
+	/**
+	* @brief Frees the limbs of all released values of the current thread, the depot and the shared pool.
+	*
+	* Afterwards all slabs without values in use are returned to the operating system
+	* unless some of their released values are kept by other threads.
+	* While an arena of any thread is open no slab is returned, because the log of the arena may reference released values.
+	*/
+	static void Trim();
+	/**
+	* @brief Getter function for the number of mpf_t values for which memory is reserved (in use or released).
+	*
+	* @return The number of reserved mpf_t values.
+	*/
+	static int GetNumberOfReservedValues();
+
+private:
+	/**
+	* @brief The free list of released mpf_t values with the same precision (in limbs).
+	*/
+	struct FreeList {
+		mp_size_t limbs;
+		MpftSlot* first;
+		int size;
+	};
+	/**
+	* @brief Destroys the pool of the current thread at the end of the thread.
+	*/
+	struct LocalPoolGuard {
+		~LocalPoolGuard();
+	};
+
+	/**
+	* @brief The constructor.
+	*/
+	MpftPool();
+	/**
+	* @brief Supplies the pool of the current thread or NULL if it is already destroyed.
+	*
+	* @return The pool of the current thread.
+	*/
+	static MpftPool* Local();
+	/**
+	* @brief Supplies the pool for threads whose own pool is already destroyed.
+	*
+	* Accesses to this pool have to be guarded by a mutex.
+	*
+	* @return The shared pool.
+	*/
+	static MpftPool* Shared();
+	/**
+	* @brief Supplies an mpf_t with value zero and the specified precision.
+	*
+	* @param precision The precision in bits.
+	*
+	* @return The pointer to the prepared mpf_t.
+	*/
+	mpf_t* Acquire(mp_bitcnt_t precision);
+	/**
+	* @brief Releases the supplied mpf_t such that it can be reused by the next acquire of the same precision.
+	*
+	* @param value The supplied mpf_t.
+	*/
+	void Release(mpf_t* value);
+	/**
+	* @brief Releases the supplied slot (see Release).
+	*
+	* @param slot The slot which is in use.
+	*/
+	void ReleaseSlot(MpftSlot* slot);
+	/**
+	* @brief Moves all released values of this pool to the depot.
+	*/
+	void Flush();
+	/**
+	* @brief Inserts the supplied slot into the matching free list.
+	*
+	* @param slot The slot which is not in use.
+	*/
+	void Insert(MpftSlot* slot);
+	/**
+	* @brief Inserts the supplied slot into the matching free list and frees its limbs
+	* if keeping them would exceed the configured limits of cached released values.
+	*
+	* @param slot The slot which is not in use.
+	*/
+	void InsertWithinLimits(MpftSlot* slot);
+	/**
+	* @brief Removes the first slot of the supplied free list.
+	*
+	* @param list The free list, which must not be empty.
+	*
+	* @return The removed slot.
+	*/
+	MpftSlot* Pop(FreeList & list);
+	/**
+	* @brief Frees the limbs of all released values of this pool.
+	*
+	* @param free_slabs Specifies whether also the slabs whose slots are all released to this pool are freed.
+	*/
+	void TrimReleasedValues(bool free_slabs);
+	/**
+	* @brief Takes a batch of released values from the depot and inserts them into the free lists.
+	*
+	* @retval true if a batch was available.
+	* @retval false otherwise.
+	*/
+	bool TakeBatchFromDepot();
+	/**
+	* @brief Supplies the mark of this pool for the next pointer of a slot in use which is owned by an arena.
+	*
+	* @param kind The kind of the mark: owned, promoted or kept until the enclosing arena is closed.
+	*
+	* @return The mark, which is never the address of a slot.
+	*/
+	MpftSlot* ArenaMark(int kind);
+	/**
+	* @brief Searches the free list for the given number of limbs and creates it if it does not exist.
+	*
+	* @param limbs The precision in limbs.
+	*
+	* @return The index of the free list.
+	*/
+	int FindFreeList(mp_size_t limbs);
+
+	/**
+	* @brief The free lists of released mpf_t values. Only few different precisions are used at the same time.
+	*/
+	std::vector<FreeList> free_lists_;
+	/**
+	* @brief The index of the free list which was used most recently.
+	*/
+	int current_free_list_;
+	/**
+	* @brief The slots which are not in use and have no limbs attached.
+	*/
+	MpftSlot* slots_without_limbs_;
+	/**
+	* @brief The number of values in the free lists.
+	*/
+	int cached_values_;
+	/**
+	* @brief The number of bytes of the limbs of the values in the free lists.
+	*/
+	long long cached_limb_bytes_;
+	/**
+	* @brief The number of mpf_t values acquired minus the number of mpf_t values released by this pool.
+	*
+	* Only the owning thread writes this value. Other threads read it to sum up the values in use.
+	*/
+	std::atomic<int> values_in_use_;
+	/**
+	* @brief The number of open arenas of this pool.
+	*/
+	int open_arenas_;
+	/**
+	* @brief The slots which were acquired while an arena was open.
+	*
+	* Each arena owns the entries behind its watermark. While a slot is owned by an arena
+	* its next pointer marks the ownership, because it is not needed for slots in use.
+	*/
+	std::vector<MpftSlot*> arena_log_;
+	/**
+	* @brief The storage of the marks of ArenaMark.
+	*
+	* The marks are distinct for each pool. A slot which was released by hand can be acquired by an arena
+	* of another thread while it is still in the log of this pool, then only the mark of the other pool is set.
+	*/
+	char arena_marks_[3];
+};
+
+} // namespace arbitraryprecisioncalculation
+
+#endif /* ARBITRARY_PRECISION_CALCULATION_MPFT_POOL_H_ */
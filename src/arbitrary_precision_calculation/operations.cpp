@@ -41,41 +41,33 @@
 #include "arbitrary_precision_calculation/operations.h"
 
 #include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <atomic>
+#include <chrono>
 #include <fstream>
-#include <queue>
+#include <mutex>
 #include <sstream>
 #include <string.h>
-#include <unordered_set>
 #include <cmath>
 
 #include "arbitrary_precision_calculation/check_condition.h"
 #include "arbitrary_precision_calculation/configuration.h"
-
-// If ARBITRARY_PRECISION_CALCULATION_OPERATIONS_CPP_USE_TAYLOR_APPROXIMATION_FOR_TRIGONOMETRC_FUNCTIONS_
-// is set to one then taylor approximation is used for trigonometric functions.
-// If it is set to zero then the CORDIC algorithm is used.
-// Here it is set to one, because even for large precision values the taylor approximation seems to be faster.
-#define ARBITRARY_PRECISION_CALCULATION_OPERATIONS_CPP_USE_TAYLOR_APPROXIMATION_FOR_TRIGONOMETRC_FUNCTIONS_ 1
+#include "arbitrary_precision_calculation/constant_calculation.h"
+#include "arbitrary_precision_calculation/mpft_pool.h"
+#include "arbitrary_precision_calculation/precision_check_policy.h"
+#include "arbitrary_precision_calculation/real.h"
+#include "arbitrary_precision_calculation/scoped_mpft_arena.h"
 
 namespace arbitraryprecisioncalculation {
 namespace vectoroperations {
 
 std::vector<mpf_t*> Add(const std::vector<mpf_t*> & a, const std::vector<mpf_t*> & b) {
-	AssertCondition(a.size() == b.size(), "Addition of vectors with different size has been executed.");
-	std::vector<mpf_t*> res(a.size(), (mpf_t*)NULL);
-	for (unsigned int i = 0; i < a.size(); i++) {
-		res[i] = mpftoperations::Add(a[i], b[i]);
-	}
-	return res;
+	return Add<precisioncheck::Checked>(a, b);
 }
 
 std::vector<mpf_t*> Subtract(const std::vector<mpf_t*> & a, const std::vector<mpf_t*> & b) {
-	AssertCondition(a.size() == b.size(), "Subtraction of vectors with different size has been executed.");
-	std::vector<mpf_t*> res(a.size(), (mpf_t*)NULL);
-	for (unsigned int i = 0; i < a.size(); i++) {
-		res[i] = mpftoperations::Subtract(a[i], b[i]);
-	}
-	return res;
+	return Subtract<precisioncheck::Checked>(a, b);
 }
 
 std::vector<mpf_t*> Divide(const std::vector<mpf_t*> & a, const std::vector<mpf_t*> & b) {
@@ -122,13 +114,7 @@ std::vector<mpf_t*> Multiply(const std::vector<mpf_t*> & a, mpf_t* b) {
 }
 
 mpf_t* Add(const std::vector<mpf_t*> & a){
-	mpf_t* res = mpftoperations::ToMpft(0.0);
-	for(unsigned int i = 0; i < a.size(); i++){
-		mpf_t* tmp = res;
-		res = mpftoperations::Add(a[i], tmp);
-		mpftoperations::ReleaseValue(tmp);
-	}
-	return res;
+	return Add<precisioncheck::Checked>(a);
 }
 
 std::vector<mpf_t*> GetConstantVector(int dimension, const double & v) {
@@ -206,33 +192,21 @@ bool Equals(const std::vector<mpf_t*> & a, const std::vector<mpf_t*> & b){
 
 // orthogonally projects the vector vec on the vector projection_vector
 std::vector<mpf_t*> OrthogonalProjection(const std::vector<mpf_t*> & vec, const std::vector<mpf_t*> & projection_vector){
-	std::vector<mpf_t*> tmp_v1, tmp_v2, result;
-	mpf_t* tmp_m1;
-	mpf_t* tmp_m2;
+	ScopedMpftArena arena;
+	mpf_t* tmp_m1 = Add(Multiply(vec, projection_vector));
+	mpf_t* tmp_m2 = Add(Multiply(projection_vector, projection_vector));
 	mpf_t* tmp_m3;
-	tmp_v1 = Multiply(vec, projection_vector);
-	tmp_m1 = Add(tmp_v1);
-	tmp_v2 = Multiply(projection_vector, projection_vector);
-	tmp_m2 = Add(tmp_v2);
 	if(mpftoperations::Compare(tmp_m2, 0.0) == 0) {
-		tmp_m3 = mpftoperations::Clone(tmp_m1);
+		tmp_m3 = tmp_m1;
 	} else {
 		tmp_m3 = mpftoperations::Divide(tmp_m1, tmp_m2);
 	}
-	result = Multiply(projection_vector, tmp_m3);
-	mpftoperations::ReleaseValue(tmp_m1);
-	mpftoperations::ReleaseValue(tmp_m2);
-	mpftoperations::ReleaseValue(tmp_m3);
-	vectoroperations::ReleaseValues(tmp_v1);
-	vectoroperations::ReleaseValues(tmp_v2);
-	return result;
+	return arena.Promote(Multiply(projection_vector, tmp_m3));
 }
 
 mpf_t* SquaredEuclideanLength(const std::vector<mpf_t*> & vec){
-	std::vector<mpf_t*> help = Multiply(vec, vec);
-	mpf_t* res = Add(help);
-	ReleaseValues(help);
-	return res;
+	ScopedMpftArena arena;
+	return arena.Promote(Add(Multiply(vec, vec)));
 }
 
 void Sort(std::vector<mpf_t*> * vec){
@@ -247,26 +221,138 @@ void Sort(std::vector<mpf_t*> * vec){
 
 namespace mpftoperations {
 
-int number_of_mpf_t_values_in_use_ = 0;
-int number_of_mpf_t_values_cached_ = 0;
-bool statistical_calculations_active_ = false;
-int statistical_calculations_active_depth_ = 0;
-std::unordered_set<mpf_t*> available_mpf_t_;
-std::queue<mpf_t*> available_mpf_t_queue_;
-int last_number_of_added_mpf_t_pointers_ = 1;
+std::atomic<int> number_of_mpf_t_values_cached_(0);
+// statistical calculations are specific for each thread
+thread_local bool statistical_calculations_active_ = false;
+thread_local int statistical_calculations_active_depth_ = 0;
 
 int GetNumberOfMpftValuesInUse() {
-	return number_of_mpf_t_values_in_use_;
+	return MpftPool::GetNumberOfValuesInUse();
 }
 
 int GetNumberOfMpftValuesCached() {
 	return number_of_mpf_t_values_cached_;
 }
 
+int GetNumberOfMpftValuesReserved() {
+	return MpftPool::GetNumberOfReservedValues();
+}
+
+void TrimMpftPool() {
+	MpftPool::Trim();
+}
+
 void ChangeNumberOfMpftValuesCached(int change){
 	number_of_mpf_t_values_cached_ += change;
 }
 
+// Values which only depend on the precision (like pi).
+// The shared values of the highest precision calculated so far are guarded by a mutex.
+// If the values are truncatable, the values for lower precisions are derived from them by truncation
+// and a higher precision is calculated with some headroom, such that slowly growing precisions rarely recalculate.
+// Otherwise the values are calculated for each precision.
+// Each thread keeps copies of the values for the LOCAL_PRECISIONS precisions used most recently,
+// such that reading them needs no synchronization and alternating precisions do not recalculate them.
+class PrecisionDependentValues {
+public:
+	PrecisionDependentValues(std::vector<mpf_t*> (*calculate)(mp_bitcnt_t precision), bool truncatable) :
+			calculate_(calculate), truncatable_(truncatable), index_(number_of_instances_++), shared_precision_(0) {}
+
+	// Returns the values for the current precision. They must not be released.
+	const std::vector<mpf_t*> & Get() {
+		return Get(mpf_get_default_prec());
+	}
+
+	// Returns the values for the specified precision. They must not be released.
+	const std::vector<mpf_t*> & Get(mp_bitcnt_t precision) {
+		static thread_local LocalCopies local;
+		if (local.copies.size() <= index_) {
+			local.copies.resize(std::max(index_ + 1, number_of_instances_),
+					std::vector<LocalCopy>(LOCAL_PRECISIONS, LocalCopy{0, 0, std::vector<mpf_t*>()}));
+		}
+		std::vector<LocalCopy> & copies = local.copies[index_];
+		local.uses++;
+		unsigned int oldest = 0;
+		for (unsigned int i = 0; i < copies.size(); i++) {
+			if (copies[i].precision == precision) {
+				copies[i].last_use = local.uses;
+				return copies[i].values;
+			}
+			if (copies[i].last_use < copies[oldest].last_use) {
+				oldest = i;
+			}
+		}
+		// cached values must not be owned by the arenas of the current thread
+		int arenas = MpftPool::SuspendArenas();
+		std::vector<mpf_t*> values;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (shared_precision_ < precision || (!truncatable_ && shared_precision_ != precision)) {
+				mp_bitcnt_t calculated_precision = precision;
+				if (truncatable_ && shared_precision_ != 0) {
+					calculated_precision = std::max(precision, shared_precision_ + shared_precision_ / 2);
+				}
+				// the calculation may access other precision dependent values
+				std::vector<mpf_t*> calculated = calculate_(calculated_precision);
+				ChangeNumberOfMpftValuesCached(calculated.size() - shared_values_.size());
+				vectoroperations::ReleaseValues(shared_values_);
+				shared_values_ = calculated;
+				shared_precision_ = calculated_precision;
+			}
+			for (unsigned int i = 0; i < shared_values_.size(); i++) {
+				// the values keep their additional bits beyond the precision
+				mpf_t* value = MpftPool::AcquireValue(mpf_get_prec(*shared_values_[i]) - (shared_precision_ - precision));
+				mpf_set(*value, *shared_values_[i]);
+				values.push_back(value);
+			}
+		}
+		// the calculation may have resized the copies of this thread
+		LocalCopy & copy = local.copies[index_][oldest];
+		ChangeNumberOfMpftValuesCached(values.size() - copy.values.size());
+		vectoroperations::ReleaseValues(copy.values);
+		copy.values = values;
+		copy.precision = precision;
+		copy.last_use = local.uses;
+		MpftPool::ResumeArenas(arenas);
+		return copy.values;
+	}
+
+private:
+	static const unsigned int LOCAL_PRECISIONS = 4;
+	struct LocalCopy {
+		mp_bitcnt_t precision;
+		unsigned long last_use;
+		std::vector<mpf_t*> values;
+	};
+	struct LocalCopies {
+		LocalCopies() : uses(0) {
+			// the copies have to be released before the pool of the thread is destroyed
+			MpftPool::PrepareLocalPool();
+		}
+		~LocalCopies() {
+			for (unsigned int i = 0; i < copies.size(); i++) {
+				for (unsigned int j = 0; j < copies[i].size(); j++) {
+					ChangeNumberOfMpftValuesCached(-(int)copies[i][j].values.size());
+					vectoroperations::ReleaseValues(copies[i][j].values);
+				}
+			}
+		}
+		// the copies of an instance stay at the same address, hence the returned references stay valid until they are replaced
+		std::vector<std::vector<LocalCopy> > copies;
+		unsigned long uses;
+	};
+
+	static unsigned int number_of_instances_;
+	std::vector<mpf_t*> (*calculate_)(mp_bitcnt_t precision);
+	const bool truncatable_;
+	const unsigned int index_;
+	std::mutex mutex_;
+	std::vector<mpf_t*> shared_values_;
+	mp_bitcnt_t shared_precision_;
+};
+
+unsigned int PrecisionDependentValues::number_of_instances_ = 0;
+
 void StatisticalCalculationsStart(){
 	++statistical_calculations_active_depth_;
 	statistical_calculations_active_ = true;
@@ -279,39 +365,53 @@ void StatisticalCalculationsEnd() {
 
 
 
-mpf_t* add_NO_CHECK(const mpf_t* a, const mpf_t* b) {
-	mpf_t* res = GetResultPointer();
-	mpf_add(*res, *a, *b);
-	return res;
+void IncreasePrecision(){
+	mp_bitcnt_t current = mpf_get_default_prec();
+	mp_bitcnt_t target = current + 10;
+	if(Configuration::getPrecisionGrowthStrategy() != configuration::PRECISION_GROWTH_LINEAR){
+		target = std::max((mp_bitcnt_t)Configuration::getRecommendedPrecision(), current + 1);
+		if(Configuration::getPrecisionGrowthStrategy() == configuration::PRECISION_GROWTH_GEOMETRIC){
+			target = std::max(target, (mp_bitcnt_t)ceil(current * Configuration::getPrecisionGrowthFactor()));
+		}
+		// the precision has to grow by at least one limb
+		if(MpftPool::PrecisionInLimbs(target) <= MpftPool::PrecisionInLimbs(current)){
+			target = current + GMP_NUMB_BITS;
+		}
+	}
+	mpf_set_default_prec(target);
 }
 
-mpf_t* subtract_NO_CHECK(const mpf_t* a, const mpf_t* b) {
-	mpf_t* res = GetResultPointer();
-	mpf_sub(*res, *a, *b);
-	return res;
+// Supplies an mpf_t with value zero and the specified precision.
+inline mpf_t* getResultPointer(mp_bitcnt_t precision) {
+	return MpftPool::AcquireValue(precision);
 }
 
-void IncreasePrecision(){
-	int curprec = mpf_get_default_prec();
-	mpf_set_default_prec(curprec + 10);
+mpf_t* GetResultPointer() {
+	return getResultPointer(mpf_get_default_prec());
 }
 
-mpf_t* GetResultPointer() {
-	++number_of_mpf_t_values_in_use_;
-	if (available_mpf_t_queue_.empty()) {
-		last_number_of_added_mpf_t_pointers_ *= 2;
-		mpf_t *next_mpf_t = new mpf_t[last_number_of_added_mpf_t_pointers_];
-		for (int i = 0; i < last_number_of_added_mpf_t_pointers_; i++) {
-			available_mpf_t_.insert(next_mpf_t + i);
-			available_mpf_t_queue_.push(next_mpf_t + i);
-		}
+mpf_t* GetResultPointer(mp_bitcnt_t precision) {
+	return getResultPointer(precision);
+}
+
+// Supplies the mpf_t which takes a regular result with the given precision instead of dst.
+// The destination is only reused if its limbs match the precision.
+inline mpf_t* destinationPointer(mpf_t* dst, mp_bitcnt_t precision) {
+	if(dst != NULL && !IsInfinite(dst) && !IsUndefined(dst)
+			&& (*dst)->_mp_prec == MpftPool::PrecisionInLimbs(precision)){
+		return dst;
 	}
+	return getResultPointer(precision);
+}
+
+inline mpf_t* destinationPointer(mpf_t* dst) {
+	return destinationPointer(dst, mpf_get_default_prec());
+}
 
-	mpf_t* res = available_mpf_t_queue_.front();
-	available_mpf_t_queue_.pop();
-	AssertCondition(available_mpf_t_.find(res) != available_mpf_t_.end(), "Internal Error. New generated mpf_t pointer is not valid.");
-	available_mpf_t_.erase(res);
-	mpf_init(*res);
+// Releases dst if it was replaced by res. Has to be called after the operands were used,
+// because dst may be the same as one of the operands.
+inline mpf_t* replaceDestination(mpf_t* dst, mpf_t* res) {
+	if(res != dst) ReleaseValue(dst);
 	return res;
 }
 
@@ -327,6 +427,15 @@ mpf_t* ToMpft(double v) {
 	return res;
 }
 
+mpf_t* ToMpft(mpf_t* dst, double v) {
+	if(std::isnan(v) || std::isinf(v)){
+		return replaceDestination(dst, ToMpft(v));
+	}
+	mpf_t* res = destinationPointer(dst);
+	mpf_set_d(*res, v);
+	return replaceDestination(dst, res);
+}
+
 mpf_t* ToMpft(long long v) {
 	if(std::abs(v) < (1LL << 30)){
 		long c = (long)v;
@@ -386,61 +495,105 @@ void ReleaseValue(mpf_t* a) {
 	if (IsUndefined(a)){
 		return;
 	}
-	AssertCondition(available_mpf_t_.find(a) == available_mpf_t_.end(), "Multiple frees on same mpf_t.");
-	number_of_mpf_t_values_in_use_--;
-	mpf_clear(*a);
-	available_mpf_t_queue_.push(a);
-	available_mpf_t_.insert(a);
+	MpftPool::ReleaseValue(a);
 }
 
-inline void checkPrecisionOnAdd(const mpf_t* a, const mpf_t* b){
-	if(Configuration::isIncreasePrecisionRecommended()) return;
-	if(Configuration::getCheckPrecisionProbability() <= 0)return;
-	bool doit = (Configuration::getCheckPrecisionMode() == configuration::CHECK_PRECISION_ALWAYS ||
-			(Configuration::getCheckPrecisionMode() == configuration::CHECK_PRECISION_ALWAYS_EXCEPT_STATISTICS
-			 && !statistical_calculations_active_));
-	if(!doit)return;
-	{
-		if(IsInfinite(a) || IsInfinite(b)) return;
-		if(IsUndefined(a) || IsUndefined(b)) return;
-	}
-	if(Configuration::getCheckPrecisionProbability() < 1){
-		mpf_t* rand_value = GetRandomMpft();
-		doit = (mpftoperations::Compare(rand_value, Configuration::getCheckPrecisionProbability()) < 0);
-		mpftoperations::ReleaseValue(rand_value);
-	}
-	if(!doit)return;
+// state of the generator which decides whether a sampled precision check is done
+thread_local unsigned long long precision_check_sample_state_ = 0x9E3779B97F4A7C15ULL;
 
-	mpf_t* tmp = GetResultPointer();
-	mpf_add(*tmp, *a, *b);
-	std::vector<mpf_t*> v = {Abs(tmp), Abs(a), Abs(b)};
-	ReleaseValue(tmp);
-	std::sort(v.begin(), v.end(), [](mpf_t* a, mpf_t* b)
-			{
-			return mpf_cmp(*a, *b) < 0; 
-			}
-			);
+// Returns a uniformly distributed value in [0,1) (xorshift64*). Much cheaper than GetRandomMpft.
+inline double nextPrecisionCheckSample(){
+	unsigned long long x = precision_check_sample_state_;
+	x ^= x >> 12;
+	x ^= x << 25;
+	x ^= x >> 27;
+	precision_check_sample_state_ = x;
+	return ((x * 0x2545F4914F6CDD1DULL) >> 11) * (1.0 / 9007199254740992.0);
+}
 
-	if(mpf_cmp_d(*v[0], 0.0) == 0){
-		if(mpf_cmp(*v[1], *v[2]) != 0){
-			Configuration::RecommendIncreasePrecision();
-		}
-	} else {
-		mpf_t* small = mpftoperations::Multiply2Exp(v[0], -Configuration::getPrecisionSafetyMargin());
-		mpf_t* addVal = GetResultPointer();
-		mpf_add(*addVal, *small, *v[2]);
-		if(mpf_cmp(*addVal, *v[2]) == 0){
-			Configuration::RecommendIncreasePrecision();
-		}
-		ReleaseValue(small);
-		ReleaseValue(addVal);
+// Bit exponent e of a nonzero value, i.e. 2^(e-1) <= |a| < 2^e.
+inline long bitExponent(const mpf_t* a){
+	mp_size_t size = std::abs((*a)->_mp_size);
+	return (long)(*a)->_mp_exp * GMP_NUMB_BITS - __builtin_clzll((*a)->_mp_d[size - 1]);
+}
+
+// The limb of |a| with weight 2^(GMP_NUMB_BITS * position).
+inline mp_limb_t limbAt(const mpf_t* a, long position){
+	mp_size_t size = std::abs((*a)->_mp_size);
+	long index = position - ((long)(*a)->_mp_exp - size);
+	if(index < 0 || index >= size) return 0;
+	return (*a)->_mp_d[index];
+}
+
+// Bit exponent of ||a| - |b|| for nonzero a and b without calculating the difference.
+// Equal leading limbs and the chain of borrows below them are skipped, afterwards three limbs suffice.
+// Returns LONG_MIN if |a| == |b|.
+long differenceBitExponent(const mpf_t* a, const mpf_t* b){
+	long position = std::max((*a)->_mp_exp, (*b)->_mp_exp) - 1;
+	long bottom = std::min((long)(*a)->_mp_exp - std::abs((*a)->_mp_size), (long)(*b)->_mp_exp - std::abs((*b)->_mp_size));
+	while(position >= bottom && limbAt(a, position) == limbAt(b, position)) --position;
+	if(position < bottom) return LONG_MIN;
+	if(limbAt(a, position) < limbAt(b, position)) std::swap(a, b);
+	mp_limb_t x[3], y[3], w[3];
+	x[2] = limbAt(a, position);
+	y[2] = limbAt(b, position);
+	if(x[2] - y[2] == 1){
+		// 1 0 0 ... - 0 F F ... cancels completely
+		while(position - 1 >= bottom && limbAt(a, position - 1) == 0 && limbAt(b, position - 1) == GMP_NUMB_MAX) --position;
+		x[2] = 1;
+		y[2] = 0;
+	}
+	for(int i = 1; i <= 2; i++){
+		x[2 - i] = limbAt(a, position - i);
+		y[2 - i] = limbAt(b, position - i);
 	}
-	for(int i = 0; i < 3; i++){
-		ReleaseValue(v[i]);
+	mpn_sub_n(w, x, y, 3);
+	for(int i = 2; i >= 0; i--){
+		if(w[i] != 0) return (position + i - 1) * GMP_NUMB_BITS - __builtin_clzll(w[i]);
 	}
+	return (position - 2) * GMP_NUMB_BITS;
 }
 
-mpf_t* Add(const mpf_t* a, const mpf_t* b) {
+bool IsPrecisionCheckDue(){
+	// checks continue after a recommendation such that the worst loss of precision is recorded
+	if(Configuration::getCheckPrecisionProbability() <= 0) return false;
+	bool doit = (Configuration::getCheckPrecisionMode() == configuration::CHECK_PRECISION_ALWAYS ||
+			(Configuration::getCheckPrecisionMode() == configuration::CHECK_PRECISION_ALWAYS_EXCEPT_STATISTICS
+			 && !statistical_calculations_active_));
+	if(!doit) return false;
+	if(Configuration::getCheckPrecisionProbability() < 1){
+		doit = (nextPrecisionCheckSample() < Configuration::getCheckPrecisionProbability());
+	}
+	return doit;
+}
+
+// Recommends an increase of the precision if the smallest of |a|, |b| and |a + b| (|a - b| for subtraction)
+// is not visible anymore in a sum with the largest of them after it is scaled down by the precision safety margin.
+// Works only on the exponents and leading limbs, hence no value is allocated.
+void CheckPrecisionOnAdd(const mpf_t* a, const mpf_t* b, bool subtraction){
+	if(IsInfinite(a) || IsInfinite(b)) return;
+	if(IsUndefined(a) || IsUndefined(b)) return;
+	// if one operand is zero the result is the other operand
+	if((*a)->_mp_size == 0 || (*b)->_mp_size == 0) return;
+	long exponent_a = bitExponent(a);
+	long exponent_b = bitExponent(b);
+	long largest = std::max(exponent_a, exponent_b);
+	long smallest = std::min(exponent_a, exponent_b);
+	if((((*a)->_mp_size < 0) != ((*b)->_mp_size < 0)) != subtraction){
+		long exponent_result = differenceBitExponent(a, b);
+		// exact cancellation
+		if(exponent_result == LONG_MIN) return;
+		smallest = std::min(smallest, exponent_result);
+	}
+	long needed_bits = largest - smallest + Configuration::getPrecisionSafetyMargin();
+	long available_bits = (long)MpftPool::PrecisionInLimbs(mpf_get_default_prec()) * GMP_NUMB_BITS;
+	if(needed_bits >= available_bits){
+		// smallest precision p with PrecisionInLimbs(p) * GMP_NUMB_BITS > needed_bits
+		Configuration::RecommendIncreasePrecision((needed_bits / GMP_NUMB_BITS) * GMP_NUMB_BITS - (GMP_NUMB_BITS - 1));
+	}
+}
+
+mpf_t* AddNoCheck(const mpf_t* a, const mpf_t* b) {
 	if(IsUndefined(a) || IsUndefined(b)){
 		return GetUndefined();
 	}
@@ -455,19 +608,57 @@ mpf_t* Add(const mpf_t* a, const mpf_t* b) {
 			return GetUndefined();
 		}
 	}
-	checkPrecisionOnAdd(a, b);
 	mpf_t* res = GetResultPointer();
 	mpf_add(*res, *a, *b);
 	return res;
 }
 
-mpf_t* Subtract(const mpf_t* a, const mpf_t* b) {
-	mpf_t* tmp = Negate(b);
-	mpf_t* res = Add(a,tmp);
-	ReleaseValue(tmp);
+mpf_t* AddNoCheck(mpf_t* dst, const mpf_t* a, const mpf_t* b) {
+	if(IsUndefined(a) || IsUndefined(b) || IsInfinite(a) || IsInfinite(b)){
+		return replaceDestination(dst, AddNoCheck(a, b));
+	}
+	mpf_t* res = destinationPointer(dst);
+	mpf_add(*res, *a, *b);
+	return replaceDestination(dst, res);
+}
+
+mpf_t* SubtractNoCheck(const mpf_t* a, const mpf_t* b) {
+	if(IsUndefined(a) || IsUndefined(b) || IsInfinite(a) || IsInfinite(b)){
+		mpf_t* tmp = Negate(b);
+		mpf_t* res = AddNoCheck(a, tmp);
+		ReleaseValue(tmp);
+		return res;
+	}
+	mpf_t* res = GetResultPointer();
+	mpf_sub(*res, *a, *b);
 	return res;
 }
 
+mpf_t* SubtractNoCheck(mpf_t* dst, const mpf_t* a, const mpf_t* b) {
+	if(IsUndefined(a) || IsUndefined(b) || IsInfinite(a) || IsInfinite(b)){
+		return replaceDestination(dst, SubtractNoCheck(a, b));
+	}
+	mpf_t* res = destinationPointer(dst);
+	mpf_sub(*res, *a, *b);
+	return replaceDestination(dst, res);
+}
+
+mpf_t* Add(const mpf_t* a, const mpf_t* b) {
+	return Add<precisioncheck::Checked>(a, b);
+}
+
+mpf_t* Add(mpf_t* dst, const mpf_t* a, const mpf_t* b) {
+	return Add<precisioncheck::Checked>(dst, a, b);
+}
+
+mpf_t* Subtract(const mpf_t* a, const mpf_t* b) {
+	return Subtract<precisioncheck::Checked>(a, b);
+}
+
+mpf_t* Subtract(mpf_t* dst, const mpf_t* a, const mpf_t* b) {
+	return Subtract<precisioncheck::Checked>(dst, a, b);
+}
+
 mpf_t* Multiply2Exp(const mpf_t* a, int p){
 	if(IsUndefined(a)){
 		return GetUndefined();
@@ -488,6 +679,19 @@ mpf_t* Multiply2Exp(const mpf_t* a, int p){
 	return res;
 }
 
+mpf_t* Multiply2Exp(mpf_t* dst, const mpf_t* a, int p){
+	if(IsUndefined(a) || IsInfinite(a)){
+		return replaceDestination(dst, Multiply2Exp(a, p));
+	}
+	mpf_t* res = destinationPointer(dst);
+	if(p < 0){
+		mpf_div_2exp(*res, *a, -p);
+	} else {
+		mpf_mul_2exp(*res, *a, p);
+	}
+	return replaceDestination(dst, res);
+}
+
 mpf_t* Multiply(const mpf_t* a, const mpf_t* b) {
 	if(IsUndefined(a) || IsUndefined(b)){
 		return GetUndefined();
@@ -515,6 +719,15 @@ mpf_t* Multiply(const mpf_t* a, const mpf_t* b) {
 	return res;
 }
 
+mpf_t* Multiply(mpf_t* dst, const mpf_t* a, const mpf_t* b) {
+	if(IsUndefined(a) || IsUndefined(b) || IsInfinite(a) || IsInfinite(b)){
+		return replaceDestination(dst, Multiply(a, b));
+	}
+	mpf_t* res = destinationPointer(dst);
+	mpf_mul(*res, *a, *b);
+	return replaceDestination(dst, res);
+}
+
 mpf_t* Multiply(const mpf_t* a, const double b) {
 	mpf_t* res = GetResultPointer();
 	mpf_t* mpf_t_b = ToMpft(b);
@@ -548,6 +761,15 @@ mpf_t* Divide(const mpf_t* a, const mpf_t* b) {
 	return res;
 }
 
+mpf_t* Divide(mpf_t* dst, const mpf_t* a, const mpf_t* b) {
+	if(IsUndefined(a) || IsUndefined(b) || IsInfinite(a) || IsInfinite(b)){
+		return replaceDestination(dst, Divide(a, b));
+	}
+	mpf_t* res = destinationPointer(dst);
+	mpf_div(*res, *a, *b);
+	return replaceDestination(dst, res);
+}
+
 mpf_t* Abs(const mpf_t* v) {
 	if(IsUndefined(v))return GetUndefined();
 	if(IsInfinite(v))return GetPlusInfinity();
@@ -567,6 +789,24 @@ mpf_t* Negate(const mpf_t* v) {
 	return res;
 }
 
+mpf_t* Abs(mpf_t* dst, const mpf_t* v) {
+	if(IsUndefined(v) || IsInfinite(v)){
+		return replaceDestination(dst, Abs(v));
+	}
+	mpf_t* res = destinationPointer(dst);
+	mpf_abs(*res, *v);
+	return replaceDestination(dst, res);
+}
+
+mpf_t* Negate(mpf_t* dst, const mpf_t* v) {
+	if(IsUndefined(v) || IsInfinite(v)){
+		return replaceDestination(dst, Negate(v));
+	}
+	mpf_t* res = destinationPointer(dst);
+	mpf_neg(*res, *v);
+	return replaceDestination(dst, res);
+}
+
 mpf_t* Clone(const mpf_t* v) {
 	if(IsPlusInfinity(v)){
 		return GetPlusInfinity();
@@ -577,10 +817,8 @@ mpf_t* Clone(const mpf_t* v) {
 	if(IsUndefined(v)){
 		return GetUndefined();
 	}
-	mpf_t* res = GetResultPointer();
+	mpf_t* res = getResultPointer(mpf_get_prec(*v));
 	mpf_set(*res, *v);
-	AssertCondition((*res)->_mp_prec >= (*v)->_mp_prec, "Cloning of mpf_t failed.");
-	(*res)->_mp_prec = (*v)->_mp_prec;
 
 	// check actual equality
 	AssertCondition((*v)->_mp_size == (*res)->_mp_size, "Cloning of mpf_t failed.");
@@ -592,76 +830,39 @@ mpf_t* Clone(const mpf_t* v) {
 	return res;
 }
 
+mpf_t* Assign(mpf_t* dst, const mpf_t* v) {
+	if(IsUndefined(v) || IsInfinite(v)){
+		return replaceDestination(dst, Clone(v));
+	}
+	// like Clone the copy keeps the precision of the source
+	mpf_t* res = destinationPointer(dst, mpf_get_prec(*v));
+	mpf_set(*res, *v);
+	return replaceDestination(dst, res);
+}
+
 // the generation of gaussian noise (random variable with normal
 // distribution) is done by minor variation of Box Muller method.
 mpf_t* GetGaussianRandomMpft(double mu, double sigma, RandomNumberGenerator* random){
-	mpf_t* u = NULL;
-	mpf_t* x = NULL;
-	mpf_t* y = NULL;
-	mpf_t* one = ToMpft(1.0);
-	mpf_t* len2_xy = NULL;
-	do {
-		ReleaseValue(u);
-		u = GetRandomMpft(random);
-	} while( Compare(u, 0.0) <= 0 );
+	Real u(GetRandomMpft(random));
+	while( u <= 0.0 ){
+		u = Real(GetRandomMpft(random));
+	}
+	Real x;
+	Real y;
+	Real len2_xy;
 	do {
-		ReleaseValue(x);
-		ReleaseValue(y);
-		ReleaseValue(len2_xy);
-
-		mpf_t* tmp1 = GetRandomMpft(random);
-		mpf_t* tmp2 = Multiply2Exp(tmp1, 1);
-		x = Subtract(tmp2, one); // x = rand(0.0, 1.0) * 2.0 - 1.0
-		ReleaseValue(tmp1);
-		ReleaseValue(tmp2);
-
-		tmp1 = GetRandomMpft(random);
-		tmp2 = Multiply2Exp(tmp1, 1);
-		y = Subtract(tmp2, one); // y = rand(0.0, 1.0) * 2.0 - 1.0
-		ReleaseValue(tmp1);
-		ReleaseValue(tmp2);
-
-		tmp1 = mpftoperations::Multiply(x,x);
-		tmp2 = mpftoperations::Multiply(y,y);
-		len2_xy = mpftoperations::Add(tmp1, tmp2); // len2_xy = x * x + y * y
-		ReleaseValue(tmp1);
-		ReleaseValue(tmp2);
-	} while( Compare(len2_xy, 0.0) == 0  || Compare(len2_xy, 1.0) > 0 );
-	mpf_t* len_xy = Sqrt(len2_xy);
-	mpf_t* len_inverse = Divide(one, len_xy); // = 1 / sqrt(x * x + y * y)
-	mpf_t* tmp = Multiply(len_inverse, x);
-	std::swap(x, tmp);
-	ReleaseValue(tmp);
-	tmp = Multiply(len_inverse,y);
-	std::swap(y, tmp);
-	ReleaseValue(tmp);
-
-	ReleaseValue(one);
-	ReleaseValue(len2_xy);
-	ReleaseValue(len_xy);
-	ReleaseValue(len_inverse);
+		x = Real(GetRandomMpft(random)).Multiply2Exp(1) - 1.0; // x = rand(0.0, 1.0) * 2.0 - 1.0
+		y = Real(GetRandomMpft(random)).Multiply2Exp(1) - 1.0; // y = rand(0.0, 1.0) * 2.0 - 1.0
+		len2_xy = x * x + y * y;
+	} while( len2_xy == 0.0 || len2_xy > 1.0 );
+	Real len_inverse = 1.0 / Sqrt(len2_xy); // = 1 / sqrt(x * x + y * y)
+	x *= len_inverse;
+	y *= len_inverse;
 	// now:
 	// u is random variable in (0,1]
 	// (x,y) is random point at the unit sphere
-	mpf_t* log_u = LogE(u);
-	mpf_t* minus_log_u = Negate(log_u);
-	mpf_t* sqrt_minus_log_u = Sqrt(minus_log_u);
-	mpf_t* x_plus_y = Add(x,y);
-	mpf_t* mul1 = Multiply(sqrt_minus_log_u, x_plus_y);
-	mpf_t* mul2 = Multiply(mul1, sigma);
-	mpf_t* mu_mpft = ToMpft(mu);
-	mpf_t* res = Add(mul2, mu_mpft);
-	ReleaseValue(u);
-	ReleaseValue(x);
-	ReleaseValue(y);
-	ReleaseValue(log_u);
-	ReleaseValue(minus_log_u);
-	ReleaseValue(sqrt_minus_log_u);
-	ReleaseValue(x_plus_y);
-	ReleaseValue(mul1);
-	ReleaseValue(mul2);
-	ReleaseValue(mu_mpft);
-	return res; // = sqrt(-log(u)) * (x + y) * sigma + mu
+	Real res = Sqrt(-LogE(u)) * (std::move(x) + y) * sigma + mu;
+	return res.Release(); // = sqrt(-log(u)) * (x + y) * sigma + mu
 }
 
 mpf_t* GetGaussianRandomMpft(double mu, double sigma){
@@ -696,225 +897,6 @@ double MpftToDouble(mpf_t* v) {
 	return mpf_get_d(*v);
 }
 
-mpf_t* Pow(mpf_t* v, double p){
-	if(IsUndefined(v)){
-		return GetUndefined();
-	}
-	if(IsInfinite(v)){
-		if(p < 0){
-			return ToMpft(0.0);
-		} else if(p == 0){
-			return ToMpft(1.0);
-		} else if(IsPlusInfinity(v)){
-			return GetPlusInfinity();
-		} else {
-			long long pp = p;
-			if(pp - p == 0){
-				if(pp % 2 == 0)return GetPlusInfinity();
-				else return GetMinusInfinity();
-			} else {
-				return GetUndefined();
-			}
-		}
-	}
-	mpf_t* tmp = ToMpft(p);
-	mpf_t* res = Pow(v, tmp);
-	ReleaseValue(tmp);
-	return res;
-}
-
-mpf_t* Pow(mpf_t* v, int p) {
-	if(IsUndefined(v)){
-		return GetUndefined();
-	}
-	if(IsInfinite(v)){
-		if(p < 0){
-			return ToMpft(0.0);
-		} else if(p == 0){
-			return ToMpft(1.0);
-		} else if(IsPlusInfinity(v)){
-			return GetPlusInfinity();
-		} else {
-			if(p % 2 == 0)return GetPlusInfinity();
-			else return GetMinusInfinity();
-		}
-	}
-	if(p < 0) {
-		mpf_t* n1 = ToMpft(1.0);
-		mpf_t* tmp = Divide(n1, v);
-		mpf_t* res = Pow(tmp, -p);
-		ReleaseValue(n1);
-		ReleaseValue(tmp);
-		return res;
-	}
-	// not using mpf_pow_ui because it produces different output on different versions!!
-    if(p == 0) {
-        return ToMpft(1);
-    }
-    if(p == 1) {
-        return Clone(v);
-    }
-    mpf_t* square_v = Multiply(v, v);
-    mpf_t* res = Pow(square_v, p / 2);
-    ReleaseValue(square_v);
-    if(p % 2 == 1){
-        mpf_t* tmp = Multiply(res, v);
-        std::swap(tmp, res);
-        ReleaseValue(tmp);
-    }
-	return res;
-}
-
-mpf_t* Pow(mpf_t* v, mpf_t* p) {
-	if(IsUndefined(v) || IsUndefined(p)){
-		return GetUndefined();
-	}
-	if(IsInfinite(p)){
-		return GetUndefined();
-	}
-	if(IsInfinite(v)){
-		if(Compare(p,0.0) < 0){
-			return ToMpft(0.0);
-		} else if(Compare(p, 0.0) == 0){
-			return ToMpft(1.0);
-		} else if(IsPlusInfinity(v)){
-			return GetPlusInfinity();
-		} else {
-			return GetUndefined();
-		}
-	}
-	if(Compare(p, 0.0) == 0) {
-		return ToMpft(1.0);
-	}
-	if(Compare(v, 0.0) == 0) {
-		return ToMpft(0.0);
-	}
-	if(Compare(v, 1.0) == 0) {
-		return ToMpft(1.0);
-	}
-	if(Compare(p, 0.0) < 0) {
-		mpf_t* n1 = ToMpft(1.0);
-		mpf_t* v_tmp = Divide(n1, v);
-		mpf_t* p_tmp = Negate(p);
-		mpf_t* res = Pow(v_tmp, p_tmp);
-		ReleaseValue(n1);
-		ReleaseValue(v_tmp);
-		ReleaseValue(p_tmp);
-		return res;
-	}
-	if(Compare(p, 1.0) >= 0) {
-		std::vector<mpf_t*> powers;
-		powers.push_back(Clone(v));
-		std::vector<mpf_t*> exponents;
-		exponents.push_back(ToMpft(1.0));
-		int i = 0;
-		while(mpf_cmp(*p, *(exponents[i])) > 0){
-			powers.push_back(Multiply(powers[i], powers[i]));
-			exponents.push_back(Add(exponents[i], exponents[i]));
-			i++;
-		}
-		mpf_t* p_tmp = Clone(p);
-		mpf_t* res = ToMpft(1.0);
-		for( ; i >= 0; i--){
-			if(mpf_cmp(*p_tmp, *(exponents[i])) >= 0) {
-				mpf_t* tmp = Subtract(p_tmp, exponents[i]);
-				std::swap(p_tmp, tmp);
-				ReleaseValue(tmp);
-				tmp = Multiply(res, powers[i]);
-				std::swap(tmp, res);
-				ReleaseValue(tmp);
-			}
-		}
-		vectoroperations::ReleaseValues(powers);
-		vectoroperations::ReleaseValues(exponents);
-		powers.clear();
-		exponents.clear();
-		mpf_t* res2 = Pow(v, p_tmp);
-		mpf_t* res1 = res;
-		res = Multiply(res1, res2);
-		ReleaseValue(res1);
-		ReleaseValue(res2);
-		ReleaseValue(p_tmp);
-		return res;
-	}
-	// 0 < p < 1, v != 0, v != 1
-	if(Compare(v, 0.0) < 0){
-		return mpftoperations::GetUndefined();
-	}
-	// 0 < p < 1, v > 0, v != 1
-	{
-		mpf_t* n1 = ToMpft(1.0);
-		mpf_t* res = ToMpft(1.0);
-		mpf_t* v_tmp = Clone(v);
-		mpf_t* p_tmp = Clone(p);
-		while(Compare(v, 0.5) < 0 || Compare(v, 1.5) > 0){
-			mpf_t* n_v = Sqrt(v_tmp);
-			mpf_t* n_p = Add(p_tmp, p_tmp);
-			ReleaseValue(v_tmp);
-			ReleaseValue(p_tmp);
-			v_tmp = n_v;
-			p_tmp = n_p;
-			if(Compare(p_tmp, 1.0) >= 0) {
-				mpf_t* tmp = Multiply(res, v_tmp);
-				std::swap(tmp, res);
-				ReleaseValue(tmp);
-				tmp =  Subtract(p_tmp, n1);
-				std::swap(tmp, p_tmp);
-				ReleaseValue(tmp);
-				if(Compare(p_tmp, 0.0) == 0) {
-					ReleaseValue(n1);
-					ReleaseValue(v_tmp);
-					ReleaseValue(p_tmp);
-					return res;
-				}
-			}
-		}
-		// 0 < p < 1, 0.5 <= v <= 1.5, v != 1
-
-		// taylor approximation:
-		mpf_t* x = Subtract(v_tmp, n1);
-		mpf_t* t_res = Clone(n1);
-		mpf_t* n = Clone(n1);
-		mpf_t* factor = Clone(n1);
-		while(true){
-			// update factor
-			mpf_t* tmp = Multiply(factor, x);
-			std::swap(factor, tmp);
-			ReleaseValue(tmp);
-			tmp = Multiply(factor, p_tmp);
-			std::swap(factor, tmp);
-			ReleaseValue(tmp);
-			tmp = Divide(factor, n);
-			std::swap(factor, tmp);
-			ReleaseValue(tmp);
-			// update p_tmp
-			tmp = Subtract(p_tmp, n1);
-			std::swap(tmp, p_tmp);
-			ReleaseValue(tmp);
-			// update n
-			tmp = Add(n, n1);
-			std::swap(n, tmp);
-			ReleaseValue(tmp);
-			// update res
-			mpf_t* n_t_res = add_NO_CHECK(t_res, factor);
-			bool same = (mpf_cmp(*t_res, *n_t_res) == 0);
-			std::swap(t_res, n_t_res);
-			ReleaseValue(n_t_res);
-			if(same)break;
-		}
-		ReleaseValue(x);
-		ReleaseValue(n);
-		ReleaseValue(factor);
-		ReleaseValue(v_tmp);
-		ReleaseValue(p_tmp);
-		ReleaseValue(n1);
-		mpf_t* a_res = Multiply(res, t_res);
-		ReleaseValue(res);
-		ReleaseValue(t_res);
-		return  a_res;
-	}
-}
-
 mpf_t* Max(mpf_t* a, mpf_t* b) {
 	if(IsPlusInfinity(a) || IsPlusInfinity(b))return GetPlusInfinity();
 	if(IsUndefined(a) || IsUndefined(b))return GetUndefined();
@@ -929,6 +911,19 @@ mpf_t* Max(mpf_t* a, mpf_t* b) {
 	return res;
 }
 
+mpf_t* Max(mpf_t* dst, mpf_t* a, mpf_t* b) {
+	if(IsUndefined(a) || IsUndefined(b) || IsInfinite(a) || IsInfinite(b)){
+		return replaceDestination(dst, Max(a, b));
+	}
+	mpf_t* res = destinationPointer(dst);
+	if (Compare(a, b) <= 0) {
+		mpf_set(*res, *b);
+	} else {
+		mpf_set(*res, *a);
+	}
+	return replaceDestination(dst, res);
+}
+
 mpf_t* Min(mpf_t* a, mpf_t* b) {
 	if(IsMinusInfinity(a) || IsMinusInfinity(b))return GetMinusInfinity();
 	if(IsUndefined(a) || IsUndefined(b))return GetUndefined();
@@ -943,6 +938,19 @@ mpf_t* Min(mpf_t* a, mpf_t* b) {
 	return res;
 }
 
+mpf_t* Min(mpf_t* dst, mpf_t* a, mpf_t* b) {
+	if(IsUndefined(a) || IsUndefined(b) || IsInfinite(a) || IsInfinite(b)){
+		return replaceDestination(dst, Min(a, b));
+	}
+	mpf_t* res = destinationPointer(dst);
+	if (Compare(a, b) >= 0) {
+		mpf_set(*res, *b);
+	} else {
+		mpf_set(*res, *a);
+	}
+	return replaceDestination(dst, res);
+}
+
 mpf_t* Floor(mpf_t* v) {
 	if(IsUndefined(v)) return GetUndefined();
 	if(IsMinusInfinity(v)) return GetMinusInfinity();
@@ -952,6 +960,15 @@ mpf_t* Floor(mpf_t* v) {
 	return res;
 }
 
+mpf_t* Floor(mpf_t* dst, mpf_t* v) {
+	if(IsUndefined(v) || IsInfinite(v)){
+		return replaceDestination(dst, Floor(v));
+	}
+	mpf_t* res = destinationPointer(dst);
+	mpf_floor(*res, *v);
+	return replaceDestination(dst, res);
+}
+
 mpf_t* Ceil(mpf_t* v) {
 	if(IsUndefined(v)) return GetUndefined();
 	if(IsMinusInfinity(v)) return GetMinusInfinity();
@@ -961,6 +978,15 @@ mpf_t* Ceil(mpf_t* v) {
 	return res;
 }
 
+mpf_t* Ceil(mpf_t* dst, mpf_t* v) {
+	if(IsUndefined(v) || IsInfinite(v)){
+		return replaceDestination(dst, Ceil(v));
+	}
+	mpf_t* res = destinationPointer(dst);
+	mpf_ceil(*res, *v);
+	return replaceDestination(dst, res);
+}
+
 mpf_t* Sqrt(mpf_t* num) {
 	if(IsUndefined(num))return GetUndefined();
 	if(IsPlusInfinity(num))return GetPlusInfinity();
@@ -971,429 +997,735 @@ mpf_t* Sqrt(mpf_t* num) {
 	return res;
 }
 
-mpf_t* cos_taylor(mpf_t* num){
-	mpf_t* res = ToMpft(0.0);
-	mpf_t* square = Multiply(num, num);
-	mpf_t* nsquare = Negate(square);
-	mpf_t* mul = ToMpft(1.0);
-	// use taylor approximation
-	for(int n = 0; true; n++){
-		mpf_t* f1 = ToMpft(n * 2 + 1.0);
-		mpf_t* f2 = ToMpft(n * 2 + 2.0);
-		mpf_t* factor = Divide(nsquare, f1);
-		mpf_t* tmp = Divide(factor, f2);
-		ReleaseValue(factor);
-		ReleaseValue(f1);
-		ReleaseValue(f2);
-		factor = tmp;
-		mpf_t* nmul = Multiply(mul, factor);
-		ReleaseValue(mul);
-		mul = nmul;
-		mpf_t* nres = add_NO_CHECK(res, mul);
-		bool same = (mpf_cmp(*res, *nres) == 0);
-		ReleaseValue(res);
-		res = nres;
-		ReleaseValue(factor);
-		if(same)break;
-	}
-	ReleaseValue(mul);
-	ReleaseValue(square);
-	ReleaseValue(nsquare);
-	mpf_t* n1 = ToMpft(1.0);
-	mpf_t* nres = Add(res, n1); // DO PRECISION CHECK HERE!!
-	ReleaseValue(n1);
-	ReleaseValue(res);
-	res = nres;
+mpf_t* Sqrt(mpf_t* dst, mpf_t* num) {
+	if(IsUndefined(num) || IsInfinite(num) || Compare(num, 0.0) < 0){
+		return replaceDestination(dst, Sqrt(num));
+	}
+	mpf_t* res = destinationPointer(dst);
+	mpf_sqrt(*res, *num);
+	return replaceDestination(dst, res);
+}
+
+// calculate Pi with the Chudnovsky series
+// with two additional limbs, such that the argument reduction of the trigonometric functions
+// and the logarithm by the arithmetic-geometric mean can use it.
+std::vector<mpf_t*> calculate_pi(mp_bitcnt_t precision){
+	return std::vector<mpf_t*>(1, constantcalculation::CalculatePiChudnovskyIncrementally(
+			Configuration::getConstantCalculationThreads(), precision + 2 * GMP_NUMB_BITS));
+}
+
+PrecisionDependentValues pi_cached_(calculate_pi, true);
+
+mpf_t* GetPi(){
+	mpf_t* res = GetResultPointer();
+	mpf_set(*res, *pi_cached_.Get()[0]);
 	return res;
 }
 
-mpf_t* sin_taylor(mpf_t* num){
-	mpf_t* mul = Clone(num);
-	mpf_t* res = Clone(num);
-	mpf_t* square = Multiply(num, num);
-	mpf_t* nsquare = Negate(square);
-	// use taylor approximation
-	for(int n = 0; true; n++){
-		mpf_t* f1 = ToMpft(n * 2 + 2.0);
-		mpf_t* f2 = ToMpft(n * 2 + 3.0);
-		mpf_t* factor = Divide(nsquare, f1);
-		mpf_t* tmp = Divide(factor, f2);
-		ReleaseValue(factor);
-		ReleaseValue(f1);
-		ReleaseValue(f2);
-		factor = tmp;
-		mpf_t* nmul = Multiply(mul, factor);
-		ReleaseValue(mul);
-		mul = nmul;
-		mpf_t* nres = add_NO_CHECK(res, mul);
-		bool same = (mpf_cmp(*res, *nres) == 0);
-		ReleaseValue(res);
-		res = nres;
-		ReleaseValue(factor);
-		if(same)break;
-	}
-	ReleaseValue(mul);
-	ReleaseValue(square);
-	ReleaseValue(nsquare);
+// pi / 2 and 2 / pi with the precision of the cached pi.
+std::vector<mpf_t*> calculate_pi_multiples(mp_bitcnt_t precision){
+	mpf_t* pi = pi_cached_.Get(precision)[0];
+	mpf_t* pi_half = getResultPointer(mpf_get_prec(*pi));
+	mpf_div_2exp(*pi_half, *pi, 1);
+	mpf_t* two_d_pi = getResultPointer(mpf_get_prec(*pi));
+	mpf_ui_div(*two_d_pi, 2, *pi);
+	std::vector<mpf_t*> res;
+	res.push_back(pi_half);
+	res.push_back(two_d_pi);
 	return res;
 }
 
-std::vector<mpf_t*> sin_cos_cordic_angles_cached_;
-unsigned int sin_cos_cordic_angles_cached_precision_ = 0;
-mpf_t* sin_cos_cordic_factor_cached_ = NULL;
-unsigned int sin_cos_cordic_factor_cached_precision_ = 0;
+PrecisionDependentValues pi_multiples_cached_(calculate_pi_multiples, true);
+
+// Arguments with a larger binary exponent are reduced by reducePayneHanek.
+// Below the product k pi / 2 loses at most this number of the guard bits of the cached pi.
+const long REDUCTION_MAXIMAL_SMALL_EXPONENT = 32;
+
+// Bits of 2 / pi for the reduction of large arguments, which are shared by all precisions.
+// The number of bits is increased on demand, such that it suffices for the largest argument so far.
+class TwoOverPiBits {
+public:
+	TwoOverPiBits() : bit_count_(0) {
+		mpz_init(bits_);
+	}
+	~TwoOverPiBits() {
+		mpz_clear(bits_);
+	}
 
-std::pair<mpf_t*, mpf_t*> sin_cos_cordic(mpf_t* num){
-	if(sin_cos_cordic_angles_cached_precision_ != mpf_get_default_prec()){
-		sin_cos_cordic_angles_cached_precision_ = mpf_get_default_prec();
-		number_of_mpf_t_values_cached_ -= sin_cos_cordic_angles_cached_.size();
-		vectoroperations::ReleaseValues(sin_cos_cordic_angles_cached_);
-		sin_cos_cordic_angles_cached_.clear();
-		mpf_t* pi = GetPi();
-		sin_cos_cordic_angles_cached_.push_back(Multiply2Exp(pi, -2));
+	// Sets window to the bits of 2 / pi with the weights 2^-first, ..., 2^-last
+	// as integer, i.e. floor(2 / pi * 2^last) mod 2^(last - first + 1).
+	void GetWindow(long first, long last, mpz_t window) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (bit_count_ < last) {
+			extend(std::max(last, 2 * bit_count_));
+		}
+		mpz_fdiv_q_2exp(window, bits_, bit_count_ - last);
+		mpz_fdiv_r_2exp(window, window, last - first + 1);
+	}
+
+private:
+	void extend(long bit_count) {
+		// the pool must not keep values of this precision in the arenas of the current thread
+		int arenas = MpftPool::SuspendArenas();
+		mp_bitcnt_t precision = bit_count + 2 * GMP_NUMB_BITS;
+		mpf_t* pi = constantcalculation::CalculatePiChudnovskyIncrementally(Configuration::getConstantCalculationThreads(), precision);
+		mpf_t* two_d_pi = getResultPointer(precision);
+		mpf_ui_div(*two_d_pi, 2, *pi);
+		mpf_mul_2exp(*two_d_pi, *two_d_pi, bit_count);
+		mpz_set_f(bits_, *two_d_pi);
+		bit_count_ = bit_count;
 		ReleaseValue(pi);
-		int p = 0;
-		mpf_t* n1 = ToMpft(1.0);
+		ReleaseValue(two_d_pi);
+		MpftPool::ResumeArenas(arenas);
+	}
+
+	std::mutex mutex_;
+	mpz_t bits_;
+	long bit_count_;
+};
+
+TwoOverPiBits two_d_pi_bits_;
+
+// Reduces num to r = num - k pi / 2 with |r| <= pi / 4 (up to rounding) and returns k mod 4 (Payne-Hanek reduction).
+// With num = M 2^e for an integer M the bits of 2 / pi with weights 2^-j for j < e - 1 only add multiples of 4
+// to num 2 / pi, hence they are skipped. Thus the number of used bits of 2 / pi is the number of bits of M
+// plus the precision and not the binary exponent of num.
+int reducePayneHanek(mpf_t* r, mpf_t* num, long exponent, mp_bitcnt_t precision){
+	// |num| = M 2^e, where M consists of the limbs of num, such that it is exact even if all limbs are used
+	long size = std::abs((*num)->_mp_size);
+	long mantissa_bits = size * GMP_NUMB_BITS;
+	long e = ((long)(*num)->_mp_exp - size) * GMP_NUMB_BITS;
+	mpz_t mantissa;
+	mpz_t product;
+	mpz_init(mantissa);
+	mpz_init(product);
+	mpz_import(mantissa, size, -1, sizeof(mp_limb_t), 0, 0, (*num)->_mp_d);
+	// the truncation of 2 / pi after the bit with weight 2^-last causes an error below 2^(exponent - last)
+	long first = std::max(1L, e - 1);
+	long last = exponent + (long)precision;
+	int quadrant = 0;
+	while(true){
+		two_d_pi_bits_.GetWindow(first, last, product);
+		// |num| 2 / pi mod 4 = (M window mod 2^(last - e + 2)) 2^-(last - e)
+		mpz_mul(product, product, mantissa);
+		mpz_fdiv_r_2exp(product, product, last - e + 2);
+		// k = round(|num| 2 / pi) mod 4
+		mpz_t k;
+		mpz_init_set_ui(k, 1);
+		mpz_mul_2exp(k, k, last - e - 1);
+		mpz_add(k, product, k);
+		mpz_fdiv_q_2exp(k, k, last - e);
+		quadrant = mpz_get_ui(k) % 4;
+		mpz_mul_2exp(k, k, last - e);
+		mpz_sub(product, product, k);
+		mpz_clear(k);
+		// the remainder has an error below M, i.e. below 2^mantissa_bits.
+		// If num is close to a multiple of pi / 2 then leading bits of the remainder cancel,
+		// which is compensated by more bits of 2 / pi.
+		long significant_bits = (long)mpz_sizeinbase(product, 2) - mantissa_bits;
+		if(mpz_sgn(product) == 0 || significant_bits >= (long)precision - GMP_NUMB_BITS)break;
+		last += (long)precision - significant_bits;
+	}
+	mpf_set_z(*r, product);
+	mpf_div_2exp(*r, *r, last - e);
+	mpf_mul(*r, *r, *pi_multiples_cached_.Get()[0]);
+	mpz_clear(mantissa);
+	mpz_clear(product);
+	if(mpf_sgn(*num) < 0){
+		mpf_neg(*r, *r);
+		quadrant = (4 - quadrant) % 4;
+	}
+	return quadrant;
+}
+
+// Reduces num to r = num - k pi / 2 with |r| <= pi / 4 (up to rounding) and returns k mod 4.
+int reduceQuarterPeriods(mpf_t* r, mpf_t* num, mp_bitcnt_t precision){
+	long exponent = 0;
+	mpf_get_d_2exp(&exponent, *num);
+	if(exponent > REDUCTION_MAXIMAL_SMALL_EXPONENT){
+		return reducePayneHanek(r, num, exponent, precision);
+	}
+	const std::vector<mpf_t*> & pi_multiples = pi_multiples_cached_.Get();
+	mpf_t* k = getResultPointer(precision);
+	mpf_mul(*k, *num, *pi_multiples[1]);
+	mpf_set_d(*r, 0.5);
+	mpf_add(*k, *k, *r);
+	mpf_floor(*k, *k);
+	int quadrant = 0;
+	if(mpf_sgn(*k) != 0){
+		// |k| < 2^REDUCTION_MAXIMAL_SMALL_EXPONENT
+		quadrant = (int)(mpf_get_si(*k) & 3);
+		// If num is close to a multiple of pi / 2 then leading bits of the remainder cancel,
+		// which is compensated by more bits of pi / 2 as in reducePayneHanek.
+		mpf_t* pi_half = pi_multiples[0];
 		while(true){
-			mpf_t* cv = Multiply2Exp(n1, --p);
-			mpf_t* inv = Arctan(cv);
-			sin_cos_cordic_angles_cached_.push_back(inv);
-			ReleaseValue(cv);
-			mpf_t* tmp = add_NO_CHECK(inv, sin_cos_cordic_angles_cached_[0]);
-			bool same = (mpf_cmp(*tmp, *(sin_cos_cordic_angles_cached_[0])) == 0);
-			ReleaseValue(tmp);
-			if(same)break;
+			mp_bitcnt_t pi_precision = mpf_get_prec(*pi_half);
+			mpf_t* difference = getResultPointer(pi_precision);
+			mpf_mul(*difference, *k, *pi_half);
+			long product_exponent;
+			mpf_get_d_2exp(&product_exponent, *difference);
+			mpf_sub(*difference, *num, *difference);
+			// the product has an error below 2^(product_exponent - pi_precision)
+			long significant_bits = 0;
+			if(mpf_sgn(*difference) != 0){
+				long difference_exponent;
+				mpf_get_d_2exp(&difference_exponent, *difference);
+				significant_bits = difference_exponent - product_exponent + (long)pi_precision;
+			}
+			if(significant_bits >= (long)precision){
+				mpf_set(*r, *difference);
+				ReleaseValue(difference);
+				break;
+			}
+			ReleaseValue(difference);
+			pi_half = pi_multiples_cached_.Get(pi_precision + std::max((long)precision - significant_bits, (long)GMP_NUMB_BITS))[0];
 		}
-		ReleaseValue(n1);
-		number_of_mpf_t_values_cached_ += sin_cos_cordic_angles_cached_.size();
-	}
-	mpf_t* cx = ToMpft(1.0);
-	mpf_t* cy = ToMpft(0.0);
-	AssertCondition(std::abs(MpftToDouble(num)) < std::acos(0.0) + 1e-7 , "CORDIC precondition not fulfilled. (sin / cos / tan calculations)");
-	mpf_t* cnum = Clone(num);
-	bool same = false;
-	for(unsigned int p = 0; p < sin_cos_cordic_angles_cached_.size() && !same; p++) {
-		mpf_t* cxs = Multiply2Exp(cx, -p);
-		mpf_t* cys = Multiply2Exp(cy, -p);
-		if(Compare(cnum, 0.0) > 0){
-			mpf_t* nnum = subtract_NO_CHECK(cnum, sin_cos_cordic_angles_cached_[p]);
-			ReleaseValue(cnum);
-			cnum = nnum;
-			mpf_t* nx = subtract_NO_CHECK(cx, cys);
-			mpf_t* ny = add_NO_CHECK(cy, cxs);
-			same = (mpf_cmp(*cx, *nx) == 0 && mpf_cmp(*cy, *ny) == 0);
-			ReleaseValue(cx);
-			ReleaseValue(cy);
-			cx = nx;
-			cy = ny;
+	} else {
+		mpf_set(*r, *num);
+	}
+	ReleaseValue(k);
+	return quadrant;
+}
+
+// Additional bits of the tapered working precisions, which cover the rounding errors of a block.
+const mp_bitcnt_t SERIES_TAPER_GUARD_BITS = 8;
+
+// Parts of a series of magnitude about 1 that are scaled by 2^log2_scale <= 1 in the sum
+// need only a working precision of about precision + log2_scale bits.
+mp_bitcnt_t taperedPrecision(mp_bitcnt_t precision, double log2_scale){
+	double tapered = (double)precision + log2_scale + SERIES_TAPER_GUARD_BITS;
+	if(tapered >= (double)precision) return precision;
+	return (mp_bitcnt_t)std::max(tapered, (double)GMP_NUMB_BITS);
+}
+
+// Calculates res = sum_{n >= 0} w^n / (d(1) d(2) ... d(n)) for the terms n < terms, where d(n) = divisor(n) are non-decreasing integers
+// and the sum is of magnitude about 1.
+// The series is evaluated by rectangular splitting: the powers w^1, ..., w^m are calculated once,
+// afterwards each block of m terms needs one multiplication.
+// Inside a block the terms are combined by Horner's scheme with multiplications by the integers d(n),
+// then the block is divided once by their product, packed into as few single limb divisions as possible.
+// Multiplications by single limbs are much cheaper than divisions by single limbs,
+// therefore this is faster than one division per term.
+// The blocks are evaluated with tapered precisions (see taperedPrecision),
+// because the block of the terms n >= mj is scaled by w^(mj) / (d(1) ... d(mj)) in the sum.
+void hypergeometricSeries(mpf_t* res, mpf_t* w, unsigned long terms, unsigned long (*divisor)(unsigned long n), mp_bitcnt_t precision){
+	unsigned long m = std::max(1UL, (unsigned long)std::sqrt((double)terms));
+	unsigned long blocks = (terms + m) / m;
+	std::vector<mpf_t*> powers(m + 1, NULL);
+	powers[1] = getResultPointer(precision);
+	mpf_set(*powers[1], *w);
+	for(unsigned long i = 2; i <= m; i++){
+		powers[i] = getResultPointer(precision);
+		mpf_mul(*powers[i], *powers[i - 1], *w);
+	}
+	// block j changes the logarithm of the scale by at most m (log2 |w| - log2 d(mj + 1)),
+	// because the divisors do not decrease, the scale of the last block is the sum of these bounds
+	long log2_w;
+	mpf_get_d_2exp(&log2_w, *w);
+	double log2_scale = 0;
+	for(unsigned long j = 0; j + 1 < blocks; j++){
+		log2_scale += (double)m * (log2_w - std::ilogb((double)divisor(m * j + 1)));
+	}
+	// S_j = sum_{n >= mj} w^(n - mj) d(1) ... d(mj) / (d(1) ... d(n))
+	// S_j d(mj + 1) ... d(mj + m) = sum_{i < m} w^i d(mj + i + 1) ... d(mj + m) + w^m S_{j + 1}
+	mpf_t* sum = getResultPointer(precision);
+	mpf_t* block = getResultPointer(precision);
+	mp_bitcnt_t allocated_precision = mpf_get_prec(*sum);
+	mpf_set_ui(*sum, 0);
+	for(unsigned long j = blocks; j-- > 0;){
+		unsigned long n = m * j;
+		mp_bitcnt_t block_precision = taperedPrecision(precision, log2_scale);
+		if(j > 0){
+			log2_scale -= (double)m * (log2_w - std::ilogb((double)divisor(n - m + 1)));
+		}
+		mpf_set_prec_raw(*block, block_precision);
+		mpf_set_ui(*block, 1);
+		for(unsigned long i = 1; i <= m; i++){
+			mpf_mul_ui(*block, *block, divisor(n + i));
+			if(i < m){
+				mpf_add(*block, *block, *powers[i]);
+			}
+		}
+		if(j + 1 < blocks){
+			// the precisions increase towards the first block
+			mpf_set_prec_raw(*sum, block_precision);
+			mpf_mul(*sum, *sum, *powers[m]);
+			mpf_add(*block, *block, *sum);
+		}
+		unsigned long packed = 1;
+		for(unsigned long i = 1; i <= m; i++){
+			unsigned long d = divisor(n + i);
+			if(packed > ULONG_MAX / d){
+				mpf_div_ui(*block, *block, packed);
+				packed = 1;
+			}
+			packed *= d;
+		}
+		mpf_div_ui(*block, *block, packed);
+		std::swap(sum, block);
+	}
+	// the values are returned to the pool with their allocated precisions
+	mpf_set_prec_raw(*sum, allocated_precision);
+	mpf_set_prec_raw(*block, allocated_precision);
+	mpf_set(*res, *sum);
+	ReleaseValue(sum);
+	ReleaseValue(block);
+	for(unsigned long i = 1; i <= m; i++){
+		ReleaseValue(powers[i]);
+	}
+}
+
+// The divisors of the series sin(r) / r = sum_n (-r^2)^n / (2n + 1)!.
+unsigned long sinDivisor(unsigned long n){
+	return (2 * n) * (2 * n + 1);
+}
+
+// Calculates res = sin(r) with the Taylor series for |r| < 2^log2_r <= 1.
+// The series sin(r) / r = sum_n w^n / (2n + 1)! in w = -r^2 is evaluated by hypergeometricSeries.
+void sinSeries(mpf_t* res, mpf_t* r, double log2_r, mp_bitcnt_t precision){
+	// number of terms such that the last term r^(2 terms - 2) / (2 terms - 1)! < 2^-(precision + 2),
+	// the terms of the alternating series decrease, hence the omitted terms sum up to less than this bound
+	unsigned long terms = 1;
+	double log2_term = 0;
+	while(log2_term > -(double)precision - 2){
+		log2_term += 2 * log2_r - std::log2(2.0 * terms * (2 * terms + 1));
+		terms++;
+	}
+	mpf_t* w = getResultPointer(precision);
+	mpf_mul(*w, *r, *r);
+	mpf_neg(*w, *w);
+	hypergeometricSeries(res, w, terms, sinDivisor, precision);
+	mpf_mul(*res, *res, *r);
+	ReleaseValue(w);
+}
+
+// The first value is the normalization factor prod_p 1 / sqrt(1 + 2^-2p) of the CORDIC rotations.
+// The remaining values are the rotation angles arctan(2^-p) for 0 <= p <= precision / 2 + 2.
+// After the rotation by arctan(2^-p) the remaining angle is at most arctan(2^-p) < 2^-p,
+// hence the remaining angle z is small enough that sin(z) = z and cos(z) = 1 up to the precision.
+// The number of angles depends on the precision, hence the values can not be truncated.
+std::vector<mpf_t*> calculate_cordic_values(mp_bitcnt_t precision){
+	std::vector<mpf_t*> values;
+	unsigned long last = precision / 2 + 2;
+	// the factors 1 + 2^-2p with 2p > precision do not change the product
+	mpf_t* product = getResultPointer(precision);
+	mpf_t* term = getResultPointer(precision);
+	mp_bitcnt_t allocated_precision = mpf_get_prec(*term);
+	mpf_set_ui(*product, 2);
+	for(unsigned long p = 1; 2 * p <= precision; p++){
+		mpf_div_2exp(*term, *product, 2 * p);
+		mpf_add(*product, *product, *term);
+	}
+	mpf_t* factor = getResultPointer(precision);
+	mpf_sqrt(*product, *product);
+	mpf_ui_div(*factor, 1, *product);
+	values.push_back(factor);
+	mpf_t* angle = getResultPointer(precision);
+	mpf_div_2exp(*angle, *pi_cached_.Get(precision)[0], 2);
+	values.push_back(angle);
+	for(unsigned long p = 1; p <= last; p++){
+		// arctan(2^-p) = sum_k (-1)^k 2^-p(2k + 1) / (2k + 1),
+		// the term k is needed with precision - 2pk bits only
+		angle = getResultPointer(precision);
+		mpf_set_ui(*angle, 0);
+		for(unsigned long k = 0; 2 * p * k <= precision; k++){
+			mpf_set_prec_raw(*term, std::max((mp_bitcnt_t)GMP_NUMB_BITS, precision - 2 * p * k));
+			mpf_set_ui(*term, 1);
+			mpf_div_ui(*term, *term, 2 * k + 1);
+			mpf_div_2exp(*term, *term, p * (2 * k + 1));
+			if(k % 2 == 0){
+				mpf_add(*angle, *angle, *term);
+			} else {
+				mpf_sub(*angle, *angle, *term);
+			}
+		}
+		values.push_back(angle);
+	}
+	// the value is returned to the pool with its allocated precision
+	mpf_set_prec_raw(*term, allocated_precision);
+	ReleaseValue(term);
+	ReleaseValue(product);
+	return values;
+}
+
+PrecisionDependentValues sin_cos_cordic_values_cached_(calculate_cordic_values, false);
+
+// Calculates sin(r) and cos(r) for |r| <= pi / 4 with the CORDIC algorithm.
+// The vector (K, 0) is rotated by the angles +-arctan(2^-p), where each rotation needs two shifts and three additions.
+// The normalization factor K compensates the lengthening of the vector by the rotations.
+// The remaining angle z is applied by sin(a + z) = sin(a) + z cos(a) and cos(a + z) = cos(a) - z sin(a).
+// The error is absolute, hence the result is only accurate relative to sin(r) if |r| is not too small.
+void sinCosCordic(mpf_t* sin_r, mpf_t* cos_r, mpf_t* r, mp_bitcnt_t precision){
+	const std::vector<mpf_t*> & values = sin_cos_cordic_values_cached_.Get(precision);
+	mpf_t* x = getResultPointer(precision);
+	mpf_t* y = getResultPointer(precision);
+	mpf_t* z = getResultPointer(precision);
+	mpf_t* shifted_x = getResultPointer(precision);
+	mpf_t* shifted_y = getResultPointer(precision);
+	mpf_set(*x, *values[0]);
+	mpf_set_ui(*y, 0);
+	mpf_set(*z, *r);
+	for(unsigned long p = 0; p + 1 < values.size(); p++){
+		mpf_div_2exp(*shifted_x, *x, p);
+		mpf_div_2exp(*shifted_y, *y, p);
+		if(mpf_sgn(*z) >= 0){
+			mpf_sub(*x, *x, *shifted_y);
+			mpf_add(*y, *y, *shifted_x);
+			mpf_sub(*z, *z, *values[p + 1]);
 		} else {
-			mpf_t* nnum = add_NO_CHECK(cnum, sin_cos_cordic_angles_cached_[p]);
-			ReleaseValue(cnum);
-			cnum = nnum;
-			mpf_t* nx = add_NO_CHECK(cx, cys);
-			mpf_t* ny = subtract_NO_CHECK(cy, cxs);
-			same = (mpf_cmp(*cx, *nx) == 0 && mpf_cmp(*cy, *ny) == 0);
-			ReleaseValue(cx);
-			ReleaseValue(cy);
-			cx = nx;
-			cy = ny;
+			mpf_add(*x, *x, *shifted_y);
+			mpf_sub(*y, *y, *shifted_x);
+			mpf_add(*z, *z, *values[p + 1]);
 		}
-		ReleaseValue(cxs);
-		ReleaseValue(cys);
-	}
-	ReleaseValue(cnum);
-	if(sin_cos_cordic_factor_cached_precision_ != mpf_get_default_prec()){
-		sin_cos_cordic_factor_cached_precision_ = mpf_get_default_prec();
-		if(sin_cos_cordic_factor_cached_ == NULL)++number_of_mpf_t_values_cached_;
-		ReleaseValue(sin_cos_cordic_factor_cached_);
-
-		mpf_t* xx = Multiply(cx, cx);
-		mpf_t* yy = Multiply(cy, cy);
-		mpf_t* slen = add_NO_CHECK(xx, yy);
-		mpf_t* sq = Sqrt(slen);
-		mpf_t* n1 = ToMpft(1.0);
-		sin_cos_cordic_factor_cached_ = Divide(n1, sq);
-		ReleaseValue(xx);
-		ReleaseValue(yy);
-		ReleaseValue(slen);
-		ReleaseValue(sq);
-		ReleaseValue(n1);
-	}
-	mpf_t* nx = Multiply(cx, sin_cos_cordic_factor_cached_);
-	mpf_t* ny = Multiply(cy, sin_cos_cordic_factor_cached_);
-	ReleaseValue(cx);
-	ReleaseValue(cy);
-	return std::make_pair(nx, ny);
-}
-
-mpf_t* sin_CORDIC(mpf_t* num){
-	std::pair<mpf_t*, mpf_t*> sc = sin_cos_cordic(num);
-	ReleaseValue(sc.first);
-	return sc.second;
-}
-
-mpf_t* cos_CORDIC(mpf_t* num){
-	std::pair<mpf_t*, mpf_t*> sc = sin_cos_cordic(num);
-	ReleaseValue(sc.second);
-	return sc.first;
-}
-
-mpf_t* arctan_taylor(mpf_t* num){
-	mpf_t* mul = Clone(num);
-	mpf_t* res = Clone(num);
-	mpf_t* square = Multiply(num, num);
-	mpf_t* nsquare = Negate(square);
-	// use taylor approximation
-	for(int n = 0; true; n++){
-		mpf_t* nmul = Multiply(mul, nsquare);
-		ReleaseValue(mul);
-		mul = nmul;
-		mpf_t* f = ToMpft(n * 2 + 3.0);
-		mpf_t* part = Divide(mul, f);
-		ReleaseValue(f);
-		mpf_t* nres = add_NO_CHECK(res, part);
-		bool same = (mpf_cmp(*res, *nres) == 0);
-		ReleaseValue(res);
-		res = nres;
-		ReleaseValue(part);
-		if(same)break;
-	}
-	ReleaseValue(mul);
-	ReleaseValue(square);
-	ReleaseValue(nsquare);
+	}
+	mpf_mul(*shifted_x, *x, *z);
+	mpf_mul(*shifted_y, *y, *z);
+	mpf_add(*sin_r, *y, *shifted_x);
+	mpf_sub(*cos_r, *x, *shifted_y);
+	ReleaseValue(x);
+	ReleaseValue(y);
+	ReleaseValue(z);
+	ReleaseValue(shifted_x);
+	ReleaseValue(shifted_y);
+}
+
+// Decides whether sine and cosine of the reduced argument are calculated with the CORDIC algorithm
+// (see Configuration::getTrigonometricAlgorithm).
+bool useCordic(mp_bitcnt_t precision){
+	switch(Configuration::getTrigonometricAlgorithm()){
+	case configuration::TRIGONOMETRIC_ALGORITHM_TAYLOR:
+		return false;
+	case configuration::TRIGONOMETRIC_ALGORITHM_CORDIC:
+		return true;
+	default:
+		return precision >= Configuration::getCordicMinimalPrecision();
+	}
+}
+
+// Calculates sin(num) and cos(num) with one shared argument reduction.
+// Only the requested values are returned, the other pointer is NULL.
+// The results are stored in the destinations if their precision fits (see destinationPointer).
+std::pair<mpf_t*, mpf_t*> sin_cos(mpf_t* num, mpf_t* dst_sin, mpf_t* dst_cos, bool need_sin, bool need_cos){
+	if(IsUndefined(num) || IsInfinite(num)){
+		return std::make_pair(need_sin ? GetUndefined() : NULL, need_cos ? GetUndefined() : NULL);
+	}
+	mp_bitcnt_t precision = mpf_get_default_prec();
+	mp_bitcnt_t working_precision = precision + GMP_NUMB_BITS;
+	mpf_t* r = getResultPointer(working_precision);
+	int quadrant = reduceQuarterPeriods(r, num, working_precision);
+	// sin(r + k pi / 2) and cos(r + k pi / 2) are +-sin(r) or +-cos(r)
+	bool swapped = (quadrant % 2 == 1);
+	bool need_cos_r = (swapped ? need_sin : need_cos);
+	mpf_t* sin_r = getResultPointer(working_precision);
+	mpf_t* cos_r = NULL;
+	if(mpf_sgn(*r) == 0){
+		mpf_set_ui(*sin_r, 0);
+	} else {
+		long r_exponent;
+		mpf_get_d_2exp(&r_exponent, *r);
+		if(useCordic(precision) && r_exponent > -GMP_NUMB_BITS / 2){
+			// the absolute error of the CORDIC algorithm cancels at most GMP_NUMB_BITS / 2 of the guard bits
+			cos_r = getResultPointer(working_precision);
+			sinCosCordic(sin_r, cos_r, r, working_precision);
+		} else {
+			sinSeries(sin_r, r, r_exponent, working_precision);
+		}
+	}
+	if(need_cos_r && cos_r == NULL){
+		// cos(r) = sqrt(1 - sin(r)^2) is well conditioned, because cos(r) >= 1 / sqrt(2)
+		cos_r = getResultPointer(working_precision);
+		mpf_mul(*cos_r, *sin_r, *sin_r);
+		mpf_ui_sub(*cos_r, 1, *cos_r);
+		mpf_sqrt(*cos_r, *cos_r);
+	}
+	ReleaseValue(r);
+	if(swapped){
+		std::swap(sin_r, cos_r);
+	}
+	std::pair<mpf_t*, mpf_t*> res(NULL, NULL);
+	if(need_sin){
+		res.first = destinationPointer(dst_sin);
+		mpf_set(*res.first, *sin_r);
+		// sin is negative in the quadrants 2 and 3
+		if(quadrant >= 2) mpf_neg(*res.first, *res.first);
+	}
+	if(need_cos){
+		res.second = destinationPointer(dst_cos);
+		mpf_set(*res.second, *cos_r);
+		// cos is negative in the quadrants 1 and 2
+		if(quadrant == 1 || quadrant == 2) mpf_neg(*res.second, *res.second);
+	}
+	if(sin_r != NULL) ReleaseValue(sin_r);
+	if(cos_r != NULL) ReleaseValue(cos_r);
 	return res;
 }
 
-mpf_t* Arctan(mpf_t* num){
-	if(IsUndefined(num))return GetUndefined();
-	if(IsInfinite(num)){
-		mpf_t* pi = GetPi();
-		mpf_t* pi_half = mpftoperations::Multiply(pi, 0.5);
-		mpftoperations::ReleaseValue(pi);
-		mpf_t* res = NULL;
-		if(IsPlusInfinity(num))res = Clone(pi_half);
-		else res = Negate(pi_half);
-		mpftoperations::ReleaseValue(pi_half);
-		return res;
+std::pair<mpf_t*, mpf_t*> SinCos(mpf_t* num){
+	return sin_cos(num, NULL, NULL, true, true);
+}
+
+std::pair<mpf_t*, mpf_t*> SinCos(mpf_t* dst_sin, mpf_t* dst_cos, mpf_t* num){
+	std::pair<mpf_t*, mpf_t*> res = sin_cos(num, dst_sin, dst_cos, true, true);
+	res.first = replaceDestination(dst_sin, res.first);
+	res.second = replaceDestination(dst_cos, res.second);
+	return res;
+}
+
+mpf_t* Tan(mpf_t* num){
+	std::pair<mpf_t*, mpf_t*> sc = SinCos(num);
+	// division by zero produces undefined value
+	mpf_t* res = Divide(sc.first, sc.second);
+	mpftoperations::ReleaseValue(sc.first);
+	mpftoperations::ReleaseValue(sc.second);
+	return res;
+}
+
+mpf_t* Tan(mpf_t* dst, mpf_t* num){
+	return replaceDestination(dst, Tan(num));
+}
+
+mpf_t* Cos(mpf_t* num){
+	return sin_cos(num, NULL, NULL, false, true).second;
+}
+
+mpf_t* Cos(mpf_t* dst, mpf_t* num){
+	return replaceDestination(dst, sin_cos(num, NULL, dst, false, true).second);
+}
+
+mpf_t* Sin(mpf_t* num){
+	return sin_cos(num, NULL, NULL, true, false).first;
+}
+
+mpf_t* Sin(mpf_t* dst, mpf_t* num){
+	return replaceDestination(dst, sin_cos(num, dst, NULL, true, false).first);
+}
+
+// Calculates res = atanh(z) = sum_k z^(2k + 1) / (2k + 1) if hyperbolic is set
+// and res = atan(z) = sum_k (-1)^k z^(2k + 1) / (2k + 1) otherwise for |z| < 2^log2_z <= 1/2.
+// The series in w = z^2 (or w = -z^2) is evaluated by rectangular splitting: the powers w^1, ..., w^m are calculated once,
+// afterwards each block of m terms needs one multiplication
+// and otherwise only additions, multiplications by integers and few divisions by integers.
+// The blocks are evaluated with tapered precisions (see taperedPrecision).
+void inverseTangentSeries(mpf_t* res, mpf_t* z, double log2_z, bool hyperbolic, mp_bitcnt_t precision){
+	// |w|^terms < 2^-precision, for |w| <= 1/4 the omitted terms sum up to less than 2^-precision 4 / 3
+	unsigned long terms = (unsigned long)(precision / (-2.0 * log2_z)) + 1;
+	unsigned long m = std::max(1UL, (unsigned long)std::sqrt((double)terms));
+	unsigned long blocks = (terms + m) / m;
+	std::vector<mpf_t*> powers(m + 1, NULL);
+	powers[1] = getResultPointer(precision);
+	mpf_mul(*powers[1], *z, *z);
+	if(!hyperbolic){
+		mpf_neg(*powers[1], *powers[1]);
+	}
+	for(unsigned long i = 2; i <= m; i++){
+		powers[i] = getResultPointer(precision);
+		mpf_mul(*powers[i], *powers[i - 1], *powers[1]);
+	}
+	// the block of the terms k >= mj is scaled by w^(mj) in the sum and is evaluated with a tapered precision
+	long log2_w;
+	mpf_get_d_2exp(&log2_w, *powers[1]);
+	// the terms of a block are summed as one fraction numerator / denominator with a single limb denominator:
+	// numerator / denominator + w^i / q = (numerator q + w^i denominator) / (denominator q)
+	mpf_t* sum = getResultPointer(precision);
+	mpf_t* numerator = getResultPointer(precision);
+	mpf_t* term = getResultPointer(precision);
+	mp_bitcnt_t allocated_precision = mpf_get_prec(*sum);
+	mpf_set_ui(*sum, 0);
+	for(unsigned long j = blocks; j-- > 0;){
+		mp_bitcnt_t block_precision = taperedPrecision(precision, (double)(m * j) * log2_w);
+		mpf_set_prec_raw(*numerator, block_precision);
+		mpf_set_prec_raw(*term, block_precision);
+		mpf_set_ui(*numerator, 1);
+		unsigned long denominator = 2 * m * j + 1;
+		for(unsigned long i = 1; i < m; i++){
+			unsigned long q = 2 * (m * j + i) + 1;
+			if(denominator > ULONG_MAX / q){
+				mpf_div_ui(*numerator, *numerator, denominator);
+				denominator = 1;
+			}
+			mpf_mul_ui(*numerator, *numerator, q);
+			if(denominator == 1){
+				mpf_add(*numerator, *numerator, *powers[i]);
+			} else {
+				mpf_mul_ui(*term, *powers[i], denominator);
+				mpf_add(*numerator, *numerator, *term);
+			}
+			denominator *= q;
+		}
+		mpf_div_ui(*numerator, *numerator, denominator);
+		if(j + 1 < blocks){
+			mpf_mul(*term, *sum, *powers[m]);
+			mpf_add(*numerator, *numerator, *term);
+		}
+		std::swap(sum, numerator);
+	}
+	// the values are returned to the pool with their allocated precisions
+	mpf_set_prec_raw(*sum, allocated_precision);
+	mpf_set_prec_raw(*numerator, allocated_precision);
+	mpf_set_prec_raw(*term, allocated_precision);
+	mpf_mul(*res, *sum, *z);
+	ReleaseValue(sum);
+	ReleaseValue(numerator);
+	ReleaseValue(term);
+	for(unsigned long i = 1; i <= m; i++){
+		ReleaseValue(powers[i]);
+	}
+}
+
+// Arguments of the series of atan are halved until they are below 2^-ATAN_HALVING_SCALE sqrt(precision).
+const double ATAN_HALVING_SCALE = 0.25;
+
+// Calculates res = atan(t) for 0 <= t <= 1 or res = atanh(t) for 0 <= t <= 1/2 if hyperbolic is set. The value of t is changed.
+// atan(t) = 2 atan(t / (1 + sqrt(1 + t^2))) (or atanh(t) = 2 atanh(t / (1 + sqrt(1 - t^2))))
+// is applied until t is small enough for a fast convergence of the series.
+void atanReduced(mpf_t* res, mpf_t* t, bool hyperbolic, mp_bitcnt_t precision){
+	if(mpf_sgn(*t) == 0){
+		mpf_set_ui(*res, 0);
+		return;
 	}
-	if(Compare(num, 0.0) < 0) {
-		// arctan is symmetric to the origin
-		mpf_t* nnum = Negate(num);
-		mpf_t* nres = Arctan(nnum);
-		mpf_t* res = Negate(nres);
-		ReleaseValue(nnum);
-		ReleaseValue(nres);
-		return res;
-	} else if(Compare(num, 0.5) > 0) {
-		// application of formula:
-		// arctan(x)=2*arctan(x/(1+sqrt(1+x*x)))
-		// this leads to smaller arguments such that
-		// taylor approximation converges much faster
-		mpf_t* square = Multiply(num, num);
-		mpf_t* n1 = ToMpft(1.0);
-		mpf_t* t1 = Add(square, n1);
-		mpf_t* t2 = Sqrt(t1);
-		mpf_t* den = Add(n1, t2);
-		mpf_t* nnum = Divide(num, den);
-		ReleaseValue(square);
-		ReleaseValue(n1);
-		ReleaseValue(t1);
-		ReleaseValue(t2);
-		ReleaseValue(den);
-		mpf_t* tmpres = Arctan(nnum);
-		mpf_t* res = Add(tmpres, tmpres);
-		ReleaseValue(tmpres);
-		ReleaseValue(nnum);
-		return res;
+	long target_exponent = -(long)(ATAN_HALVING_SCALE * std::sqrt((double)precision)) - 1;
+	long t_exponent;
+	mpf_get_d_2exp(&t_exponent, *t);
+	unsigned long halvings = 0;
+	while(t_exponent > target_exponent){
+		mpf_mul(*res, *t, *t);
+		if(hyperbolic){
+			mpf_ui_sub(*res, 1, *res);
+		} else {
+			mpf_add_ui(*res, *res, 1);
+		}
+		mpf_sqrt(*res, *res);
+		mpf_add_ui(*res, *res, 1);
+		mpf_div(*t, *t, *res);
+		halvings++;
+		mpf_get_d_2exp(&t_exponent, *t);
+	}
+	inverseTangentSeries(res, t, t_exponent, hyperbolic, precision);
+	mpf_mul_2exp(*res, *res, halvings);
+}
+
+// Calculates res = atan2(y, x), i.e. the angle of the point (x, y) in (-pi, pi], for finite values.
+// The absolute value of the quotient, which is passed to the series, is at most 1.
+void atan2Finite(mpf_t* res, mpf_t* y, mpf_t* x, mp_bitcnt_t precision){
+	mpf_t* pi = pi_cached_.Get()[0];
+	if(mpf_sgn(*y) == 0){
+		if(mpf_sgn(*x) < 0){
+			mpf_set(*res, *pi);
+		} else {
+			mpf_set_ui(*res, 0);
+		}
+		return;
+	}
+	mpf_t* t = getResultPointer(precision);
+	// atan(|y| / |x|) = pi / 2 - atan(|x| / |y|)
+	mpf_abs(*t, *y);
+	mpf_abs(*res, *x);
+	bool swapped = (mpf_cmp(*t, *res) > 0);
+	if(swapped){
+		mpf_div(*t, *res, *t);
 	} else {
-		return arctan_taylor(num);
+		mpf_div(*t, *t, *res);
+	}
+	atanReduced(res, t, false, precision);
+	if(swapped){
+		mpf_sub(*res, *pi_multiples_cached_.Get()[0], *res);
 	}
+	if(mpf_sgn(*x) < 0){
+		mpf_sub(*res, *pi, *res);
+	}
+	if(mpf_sgn(*y) < 0){
+		mpf_neg(*res, *res);
+	}
+	ReleaseValue(t);
 }
 
-mpf_t* Arcsin(mpf_t* num){
-	if(IsUndefined(num))return GetUndefined();
-	if(IsInfinite(num))return GetUndefined();
-	// case num = -1 or num = +1
-	if(Compare(num, 1.0) == 0
-			|| Compare(num, -1.0) == 0) {
-		mpf_t* pi = GetPi();
-		mpf_t* n2 = ToMpft(2.0);
-		mpf_t* res = Divide(pi, n2);
-		ReleaseValue(pi);
-		ReleaseValue(n2);
-		if(Compare(num, -1.0) == 0){
-			mpf_t* tmp = Negate(res);
-			ReleaseValue(res);
-			res = tmp;
+// Returns atan2(y, x) with the current precision for finite values.
+mpf_t* atan2Rounded(mpf_t* y, mpf_t* x){
+	mp_bitcnt_t working_precision = mpf_get_default_prec() + GMP_NUMB_BITS;
+	mpf_t* res = getResultPointer(working_precision);
+	atan2Finite(res, y, x, working_precision);
+	mpf_t* rounded = GetResultPointer();
+	mpf_set(*rounded, *res);
+	ReleaseValue(res);
+	return rounded;
+}
+
+mpf_t* Atan2(mpf_t* y, mpf_t* x){
+	if(IsUndefined(y) || IsUndefined(x))return GetUndefined();
+	if(IsInfinite(y) || IsInfinite(x)){
+		// the angle of the limit direction, where finite coordinates count as zero
+		mpf_t* direction_y = ToMpft(IsPlusInfinity(y) ? 1.0 : (IsMinusInfinity(y) ? -1.0 : 0.0));
+		mpf_t* direction_x = ToMpft(IsPlusInfinity(x) ? 1.0 : (IsMinusInfinity(x) ? -1.0 : 0.0));
+		mpf_t* res = atan2Rounded(direction_y, direction_x);
+		if(!IsInfinite(y) && mpf_sgn(*y) < 0 && IsMinusInfinity(x)){
+			// below the negative x axis the angle is -pi
+			res = Negate(res, res);
 		}
+		ReleaseValue(direction_y);
+		ReleaseValue(direction_x);
 		return res;
 	}
-	if(Compare(num, -1.0) < 0){
-		return GetUndefined();
-	}
-	if(Compare(num,  1.0) > 0){
-		return GetUndefined();
-	}
-	// application of formula:
-	// arcsin(x) = arctan(x / sqrt(1 - x * x))
+	return atan2Rounded(y, x);
+}
+
+mpf_t* Atan2(mpf_t* dst, mpf_t* y, mpf_t* x){
+	return replaceDestination(dst, Atan2(y, x));
+}
+
+mpf_t* Arctan(mpf_t* num){
+	if(IsUndefined(num))return GetUndefined();
 	mpf_t* n1 = ToMpft(1.0);
-	mpf_t* squ = Multiply(num, num);
-	mpf_t* sqDen = Subtract(n1, squ);
-	mpf_t* den = Sqrt(sqDen);
-	mpf_t* nval = Divide(num, den);
-	mpf_t* res = Arctan(nval);
+	mpf_t* res = Atan2(num, n1);
 	ReleaseValue(n1);
-	ReleaseValue(squ);
-	ReleaseValue(sqDen);
-	ReleaseValue(den);
-	ReleaseValue(nval);
 	return res;
 }
 
-mpf_t* Arccos(mpf_t* num){
-	mpf_t* pi = GetPi();
-	mpf_t* n2 = ToMpft(2.0);
-	mpf_t* pi_d2 = Divide(pi, n2);
-	mpf_t* a_sin = Arcsin(num);
-	mpf_t* res = Subtract(pi_d2, a_sin);
-	ReleaseValue(pi);
-	ReleaseValue(n2);
-	ReleaseValue(pi_d2);
-	ReleaseValue(a_sin);
-	return res;
+mpf_t* Arctan(mpf_t* dst, mpf_t* num){
+	return replaceDestination(dst, Arctan(num));
 }
 
-mpf_t* Tan(mpf_t* num){
-	mpf_t* nume = Sin(num);
-	mpf_t* deno = Cos(num);
-	// division by zero produces undefined value
-	mpf_t* res = Divide(nume, deno);
-	mpftoperations::ReleaseValue(nume);
-	mpftoperations::ReleaseValue(deno);
-	return res;
+// Calculates sqrt(1 - num^2) = sqrt((1 - num) (1 + num)) into res, which avoids the cancellation for |num| close to 1.
+void cosOfArcsin(mpf_t* res, mpf_t* num, mp_bitcnt_t precision){
+	mpf_t* factor = getResultPointer(precision);
+	mpf_ui_sub(*res, 1, *num);
+	mpf_add_ui(*factor, *num, 1);
+	mpf_mul(*res, *res, *factor);
+	mpf_sqrt(*res, *res);
+	ReleaseValue(factor);
 }
 
-mpf_t* Cos(mpf_t* num){
+mpf_t* Arcsin(mpf_t* num){
 	if(IsUndefined(num))return GetUndefined();
 	if(IsInfinite(num))return GetUndefined();
-	// application of formula:
-	// cos(alpha) = sin(alpha + pi / 2)
-	mpf_t* pi = GetPi();
-	mpf_t* pi_half = Multiply2Exp(pi, -1);
-	mpf_t* nnum = Add(num, pi_half); // DO PRECISION CHECK HERE!!
-	mpf_t* res = Sin(nnum);
-	ReleaseValue(nnum);
-	ReleaseValue(pi_half);
-	ReleaseValue(pi);
+	if(Compare(num, -1.0) < 0 || Compare(num, 1.0) > 0)return GetUndefined();
+	// arcsin(x) = atan2(x, sqrt(1 - x^2))
+	mpf_t* root = getResultPointer(mpf_get_default_prec() + GMP_NUMB_BITS);
+	cosOfArcsin(root, num, mpf_get_prec(*root));
+	mpf_t* res = atan2Rounded(num, root);
+	ReleaseValue(root);
 	return res;
 }
 
-mpf_t* Sin(mpf_t* num){
+mpf_t* Arcsin(mpf_t* dst, mpf_t* num){
+	return replaceDestination(dst, Arcsin(num));
+}
+
+mpf_t* Arccos(mpf_t* num){
 	if(IsUndefined(num))return GetUndefined();
 	if(IsInfinite(num))return GetUndefined();
-	num = Clone(num);
-	mpf_t* pi = GetPi();
-	mpf_t* minus_pi = Negate(pi);
-	mpf_t* n1 = ToMpft(1.0);
-	mpf_t* pi_half = Multiply2Exp(pi, -1);
-	mpf_t* pi_d4 = Multiply2Exp(pi_half, -1);
-	mpf_t* n1d2 = Multiply2Exp(n1, -1);
-	mpf_t* n2_pi = Multiply2Exp(pi, 1);
-	mpf_t* absnum = Abs(num);
-
-	// move in interval -pi..pi
-	if(mpf_cmp(*absnum, *pi) > 0){
-		// use formula
-		// sin(alpha) = sin(alpha + m * 2 * pi)
-		// for all integers m
-		mpf_t* num_d_pi = Divide(num, n2_pi);
-		mpf_t* num_d_pi_phalf = add_NO_CHECK(num_d_pi, n1d2);
-		mpf_t* num_d_pi_round = GetResultPointer();
-		mpf_floor(*num_d_pi_round, *num_d_pi_phalf);
-		mpf_t* move = Multiply(num_d_pi_round, n2_pi);
-		mpf_t* nnum = Subtract(num, move); // DO PRECISION CHECK HERE!!
-		ReleaseValue(num);
-		ReleaseValue(num_d_pi);
-		ReleaseValue(num_d_pi_phalf);
-		ReleaseValue(num_d_pi_round);
-		ReleaseValue(move);
-		num = nnum;
-		ReleaseValue(absnum);
-		absnum = Abs(num);
-	}
-
-	if(mpf_cmp(*absnum, *pi) > 0){
-		// happens only if initial num is very large
-		mpf_t* res = Sin(num);
-		ReleaseValue(num);
-		ReleaseValue(pi);
-		ReleaseValue(minus_pi);
-		ReleaseValue(n1);
-		ReleaseValue(pi_half);
-		ReleaseValue(pi_d4);
-		ReleaseValue(n1d2);
-		ReleaseValue(n2_pi);
-		ReleaseValue(absnum);
-		return res;
-	}
-
-	// move in interval 0 .. pi
-	bool doNegate = false;
-	if(Compare(num, 0.0) < 0){
-		// application of formula:
-		// sin(alpha) = -sin(-alpha)
-		doNegate = true;
-		mpf_t* nnum = Negate(num);
-		ReleaseValue(num);
-		num = nnum;
-	}
-	// move in interval 0 .. pi/2
-	if(mpf_cmp(*num, *pi_half) > 0){
-		// application of formula:
-		// sin(alpha) = sin(pi - alpha)
-		mpf_t* nnum = Subtract(pi, num); // DO PRECISION CHECK HERE!!
-		ReleaseValue(num);
-		num = nnum;
-	}
-	// move in interval 0 .. pi/4
-	bool doCosinus = false;
-	if(mpf_cmp(*num, *pi_d4) > 0){
-		// application of formula:
-		// sin(alpha) = cos(alpha - pi / 2)
-		doCosinus = true;
-		mpf_t* nnum = Subtract(pi_half, num); // DO PRECISION CHECK HERE!!
-		ReleaseValue(num);
-		num = nnum;
-	}
-
-	ReleaseValue(pi);
-	ReleaseValue(minus_pi);
-	ReleaseValue(n1);
-	ReleaseValue(pi_half);
-	ReleaseValue(pi_d4);
-	ReleaseValue(n1d2);
-	ReleaseValue(n2_pi);
-	ReleaseValue(absnum);
-
-	mpf_t* res = NULL;
-
-#if ARBITRARY_PRECISION_CALCULATION_OPERATIONS_CPP_USE_TAYLOR_APPROXIMATION_FOR_TRIGONOMETRC_FUNCTIONS_ // use taylor approximation
-	if(doCosinus)res = cos_taylor(num);
-	else res = sin_taylor(num);
-#else // use CORDIC-algorithm
-	if(doCosinus)res = cos_CORDIC(num);
-	else res = sin_CORDIC(num);
-#endif
-
-	ReleaseValue(num);
-	if(doNegate){
-		mpf_t* tmp = Negate(res);
-		ReleaseValue(res);
-		res = tmp;
-	}
+	if(Compare(num, -1.0) < 0 || Compare(num, 1.0) > 0)return GetUndefined();
+	// arccos(x) = atan2(sqrt(1 - x^2), x), which has no cancellation for x close to 1
+	mpf_t* root = getResultPointer(mpf_get_default_prec() + GMP_NUMB_BITS);
+	cosOfArcsin(root, num, mpf_get_prec(*root));
+	mpf_t* res = atan2Rounded(root, num);
+	ReleaseValue(root);
 	return res;
 }
 
+mpf_t* Arccos(mpf_t* dst, mpf_t* num){
+	return replaceDestination(dst, Arccos(num));
+}
+
 int Compare(const mpf_t* a, const double b){
 	AssertCondition(!IsUndefined(a) && !std::isnan(b), "Comparisons with undefined values are not possible. Please check whether your functions or statistics can produce undefined values.");
 	if(std::isfinite(b)){
@@ -1457,21 +1789,22 @@ int Compare(const mpf_t* a, const mpf_t* b){
 	return res;
 }
 
-mpf_t* mpft_plus_infinity_cached_ = NULL;
+// Supplies a new mpf_t which will be cached for the whole execution.
+mpf_t* createCachedValue(){
+	int arenas = MpftPool::SuspendArenas();
+	mpf_t* res = GetResultPointer();
+	MpftPool::ResumeArenas(arenas);
+	ChangeNumberOfMpftValuesCached(1);
+	return res;
+}
+
 mpf_t* GetPlusInfinity(){
-	if(mpft_plus_infinity_cached_ == NULL){
-		mpft_plus_infinity_cached_ = GetResultPointer();
-		ChangeNumberOfMpftValuesCached(1);
-	}
+	static mpf_t* mpft_plus_infinity_cached_ = createCachedValue();
 	return mpft_plus_infinity_cached_;
 }
 
-mpf_t* mpft_minus_infinity_cached_ = NULL;
 mpf_t* GetMinusInfinity(){
-	if(mpft_minus_infinity_cached_ == NULL) {
-		mpft_minus_infinity_cached_ = GetResultPointer();
-		ChangeNumberOfMpftValuesCached(1);
-	}
+	static mpf_t* mpft_minus_infinity_cached_ = createCachedValue();
 	return mpft_minus_infinity_cached_;
 }
 
@@ -1485,12 +1818,8 @@ bool IsInfinite(const mpf_t* v){
 	return IsPlusInfinity(v) || IsMinusInfinity(v);
 }
 
-mpf_t* mpft_undefined_ = NULL;
 mpf_t* GetUndefined(){
-	if(mpft_undefined_ == NULL){
-		mpft_undefined_ = GetResultPointer();
-		ChangeNumberOfMpftValuesCached(1);
-	}
+	static mpf_t* mpft_undefined_ = createCachedValue();
 	return mpft_undefined_;
 }
 
@@ -1498,164 +1827,348 @@ bool IsUndefined(const mpf_t* v){
 	return v == GetUndefined();
 }
 
-mpf_t* pi_cached_ = NULL;
-unsigned int pi_cached_precision_ = 1;
-mpf_t* GetPi(){
-	if(pi_cached_ == NULL || mpf_get_default_prec() != pi_cached_precision_){
-		if(pi_cached_ == NULL)number_of_mpf_t_values_cached_++;
-		// calculate Pi with Bailey-Borwein-Plouffe formula
-		ReleaseValue(pi_cached_);
-		pi_cached_ = NULL;
-		pi_cached_precision_ = mpf_get_default_prec();
-		mpf_t* n16 = ToMpft(16.0);
-		mpf_t* n8 = ToMpft(8.0);
-		mpf_t* n6 = ToMpft(6.0);
-		mpf_t* n5 = ToMpft(5.0);
-		mpf_t* n4 = ToMpft(4.0);
-		mpf_t* n2 = ToMpft(2.0);
-		mpf_t* n1 = ToMpft(1.0);
-		mpf_t* n0 = ToMpft(0.0);
-		mpf_t* n1d16 = Divide(n1, n16);
-		mpf_t* mul = Clone(n1);
-		mpf_t* k8 = Clone(n0);
-		mpf_t* res = Clone(n0);
-		bool finish = false;
-		while(!finish){
-			mpf_t* d1 = add_NO_CHECK(k8, n1);
-			mpf_t* t1 = Divide(n4, d1);
-			mpf_t* d2 = add_NO_CHECK(k8, n4);
-			mpf_t* t2 = Divide(n2, d2);
-			mpf_t* d3 = add_NO_CHECK(k8, n5);
-			mpf_t* t3 = Divide(n1, d3);
-			mpf_t* d4 = add_NO_CHECK(k8, n6);
-			mpf_t* t4 = Divide(n1, d4);
-			mpf_t* t12 = subtract_NO_CHECK(t1, t2);
-			mpf_t* t123 = subtract_NO_CHECK(t12, t3);
-			mpf_t* t1234 = subtract_NO_CHECK(t123, t4);
-			mpf_t* curAdd = Multiply(t1234, mul);
-			mpf_t* nres = add_NO_CHECK(res, curAdd);
-			finish = (mpf_cmp(*res, *nres) == 0);
-			ReleaseValue(res);
-			res = nres;
-			mpf_t* nk8 = add_NO_CHECK(k8, n8);
-			ReleaseValue(k8);
-			k8 = nk8;
-			mpf_t* nmul = Multiply(mul, n1d16);
-			ReleaseValue(mul);
-			mul = nmul;
-			ReleaseValue(d1);
-			ReleaseValue(t1);
-			ReleaseValue(d2);
-			ReleaseValue(t2);
-			ReleaseValue(d3);
-			ReleaseValue(t3);
-			ReleaseValue(d4);
-			ReleaseValue(t4);
-			ReleaseValue(t12);
-			ReleaseValue(t123);
-			ReleaseValue(t1234);
-			ReleaseValue(curAdd);
-		}
-		ReleaseValue(n16);
-		ReleaseValue(n8);
-		ReleaseValue(n6);
-		ReleaseValue(n5);
-		ReleaseValue(n4);
-		ReleaseValue(n2);
-		ReleaseValue(n1);
-		ReleaseValue(n0);
-		ReleaseValue(n1d16);
-		ReleaseValue(mul);
-		ReleaseValue(k8);
-		pi_cached_ = res;
-	}
-	return Clone(pi_cached_);
-}
-
-mpf_t* e_cached = NULL;
-unsigned int e_cached_precision = 1;
+// e with two additional limbs like the other constants.
+std::vector<mpf_t*> calculate_e(mp_bitcnt_t precision){
+	return std::vector<mpf_t*>(1, constantcalculation::CalculateEIncrementally(precision + 2 * GMP_NUMB_BITS));
+}
+
+PrecisionDependentValues e_cached_(calculate_e, true);
+
 mpf_t* GetE(){
-	if(e_cached == NULL || mpf_get_default_prec() != e_cached_precision){
-		if(e_cached == NULL)number_of_mpf_t_values_cached_++;
-		ReleaseValue(e_cached);
-		e_cached = NULL;
-		e_cached_precision = mpf_get_default_prec();
-		mpf_t* n1 = ToMpft(1.0);
-		e_cached = Exp(n1);
-		ReleaseValue(n1);
-	}
-	return Clone(e_cached);
+	mpf_t* res = GetResultPointer();
+	mpf_set(*res, *e_cached_.Get()[0]);
+	return res;
 }
 
-mpf_t* exp_taylor(mpf_t* v){
-	mpf_t* n1 = ToMpft(1.0);
-	mpf_t* res = Clone(n1);
-	mpf_t* n = Clone(n1);
-	mpf_t* factor = Clone(n1);
-	while(true){
-		mpf_t* tmp = Divide(factor, n);
-		std::swap(tmp, factor);
-		ReleaseValue(tmp);
-		tmp = Multiply(factor, v);
-		std::swap(tmp, factor);
-		ReleaseValue(tmp);
-		tmp = Add(n, n1);
-		std::swap(n, tmp);
-		ReleaseValue(tmp);
-		mpf_t* nres = add_NO_CHECK(res, factor);
-		bool same = (mpf_cmp(*nres, *res) == 0);
-		ReleaseValue(res);
-		res = nres;
-		if(same)break;
-	}
-	ReleaseValue(n1);
-	ReleaseValue(n);
-	ReleaseValue(factor);
+// ln(2) with two additional limbs, such that the argument reduction of Exp can subtract large multiples of it.
+std::vector<mpf_t*> calculate_ln2(mp_bitcnt_t precision){
+	return std::vector<mpf_t*>(1, constantcalculation::CalculateLn2Incrementally(precision + 2 * GMP_NUMB_BITS));
+}
+
+PrecisionDependentValues ln2_cached_(calculate_ln2, true);
+
+mpf_t* GetLn2(){
+	mpf_t* res = GetResultPointer();
+	mpf_set(*res, *ln2_cached_.Get()[0]);
 	return res;
 }
 
+// ln(10) = 3 ln(2) + ln(5 / 4) with two additional limbs.
+std::vector<mpf_t*> calculate_ln10(mp_bitcnt_t precision){
+	mpf_t* res = constantcalculation::CalculateLogRatioIncrementally(5, 4, precision + 2 * GMP_NUMB_BITS);
+	mpf_t* ln2 = ln2_cached_.Get(precision)[0];
+	mpf_t* multiple = getResultPointer(mpf_get_prec(*ln2));
+	mpf_mul_ui(*multiple, *ln2, 3);
+	mpf_add(*res, *res, *multiple);
+	ReleaseValue(multiple);
+	return std::vector<mpf_t*>(1, res);
+}
+
+PrecisionDependentValues ln10_cached_(calculate_ln10, true);
+
+mpf_t* GetLn10(){
+	mpf_t* res = GetResultPointer();
+	mpf_set(*res, *ln10_cached_.Get()[0]);
+	return res;
+}
+
+// sqrt(2) with two additional limbs.
+std::vector<mpf_t*> calculate_sqrt2(mp_bitcnt_t precision){
+	mpf_t* res = getResultPointer(precision + 2 * GMP_NUMB_BITS);
+	mpf_sqrt_ui(*res, 2);
+	return std::vector<mpf_t*>(1, res);
+}
+
+PrecisionDependentValues sqrt2_cached_(calculate_sqrt2, true);
+
+mpf_t* GetSqrt2(){
+	mpf_t* res = GetResultPointer();
+	mpf_set(*res, *sqrt2_cached_.Get()[0]);
+	return res;
+}
+
+// Up to this absolute value of the argument of Exp the multiple of ln(2) is calculated exactly with doubles.
+// Larger arguments calculate the multiple with mpf_t values and need ln(2) with additional bits.
+const double EXP_MAXIMAL_REDUCED_ARGUMENT = 1e15;
+
+// From this absolute value of the argument on exp overflows to infinity (or underflows to zero),
+// because the exponent of mpf_t counts limbs in a long.
+const double EXP_OVERFLOW_ARGUMENT = (double)(LONG_MAX / 2) * GMP_NUMB_BITS * M_LN2;
+
+// Returns whether exp(v) is not representable as a finite positive mpf_t value.
+bool expOverflows(mpf_t* v){
+	return mpf_cmp_d(*v, EXP_OVERFLOW_ARGUMENT) >= 0 || mpf_cmp_d(*v, -EXP_OVERFLOW_ARGUMENT) <= 0;
+}
+
+// Number of squarings after the evaluation of the series in Exp.
+// The argument of the series is divided by 2^squarings, which reduces the number of terms.
+unsigned long expSquarings(mp_bitcnt_t precision){
+	return (unsigned long)std::sqrt((double)precision) / 4;
+}
+
+// The divisors of the series exp(r) = sum_n r^n / n!.
+unsigned long expDivisor(unsigned long n){
+	return n;
+}
+
+// Calculates res = exp(r) with the Taylor series for |r| < 2^log2_r <= 1/2.
+// The series is evaluated by hypergeometricSeries.
+void expSeries(mpf_t* res, mpf_t* r, double log2_r, mp_bitcnt_t precision){
+	// number of terms such that r^terms / terms! < 2^-(precision + 2),
+	// for |r| <= 1/2 the omitted terms sum up to less than twice this bound
+	unsigned long terms = 1;
+	double log2_term = log2_r;
+	while(log2_term > -(double)precision - 2){
+		terms++;
+		log2_term += log2_r - std::log2((double)terms);
+	}
+	hypergeometricSeries(res, r, terms, expDivisor, precision);
+}
+
+// Calculates res = exp(v) for finite v with a relative error of about 2^-precision, where exp(v) must not overflow (see expOverflows).
+// The precision may exceed the default precision by at most GMP_NUMB_BITS,
+// because the cached value of ln(2) carries only two additional limbs.
+void expFinite(mpf_t* res, mpf_t* v, mp_bitcnt_t precision){
+	// exp(v) = 2^k exp(r)^(2^squarings) with r = (v - k ln(2)) / 2^squarings
+	unsigned long squarings = expSquarings(precision);
+	mp_bitcnt_t working_precision = precision + squarings + GMP_NUMB_BITS;
+	double v_double = mpf_get_d(*v);
+	mpz_t k;
+	mpz_init(k);
+	mpf_t* r = NULL;
+	mpf_t* multiple = NULL;
+	if(std::abs(v_double) <= EXP_MAXIMAL_REDUCED_ARGUMENT){
+		long k_small = std::lround(v_double / M_LN2);
+		mpz_set_si(k, k_small);
+		r = getResultPointer(working_precision + 2 * GMP_NUMB_BITS);
+		multiple = getResultPointer(working_precision + 2 * GMP_NUMB_BITS);
+		mpf_mul_ui(*multiple, *ln2_cached_.Get()[0], std::labs(k_small));
+	} else {
+		// k ln(2) cancels the bits of k, hence ln(2) is needed with these bits in addition
+		long v_exponent;
+		mpf_get_d_2exp(&v_exponent, *v);
+		mp_bitcnt_t k_bits = v_exponent + 1;
+		mpf_t* ln2 = ln2_cached_.Get(working_precision + k_bits)[0];
+		r = getResultPointer(working_precision + k_bits + 2 * GMP_NUMB_BITS);
+		multiple = getResultPointer(working_precision + k_bits + 2 * GMP_NUMB_BITS);
+		// k = floor(v / ln(2) + 1/2) is exact, because the quotient has more bits than k
+		mpf_div(*r, *v, *ln2);
+		mpf_set_d(*multiple, 0.5);
+		mpf_add(*r, *r, *multiple);
+		mpf_floor(*r, *r);
+		mpz_set_f(k, *r);
+		mpf_set_z(*multiple, k);
+		mpf_abs(*multiple, *multiple);
+		mpf_mul(*multiple, *multiple, *ln2);
+	}
+	mpf_set(*r, *v);
+	if(mpz_sgn(k) > 0){
+		mpf_sub(*r, *r, *multiple);
+	} else if(mpz_sgn(k) < 0){
+		mpf_add(*r, *r, *multiple);
+	}
+	ReleaseValue(multiple);
+	mpf_t* series = getResultPointer(working_precision);
+	if(mpf_sgn(*r) == 0){
+		mpf_set_ui(*series, 1);
+	} else {
+		mpf_div_2exp(*r, *r, squarings);
+		long r_exponent;
+		mpf_get_d_2exp(&r_exponent, *r);
+		expSeries(series, r, r_exponent, working_precision);
+		for(unsigned long i = 0; i < squarings; i++){
+			mpf_mul(*series, *series, *series);
+		}
+	}
+	ReleaseValue(r);
+	mpf_set(*res, *series);
+	ReleaseValue(series);
+	// 2^k is applied in steps which fit into the shift counts of GMP
+	bool negative = (mpz_sgn(k) < 0);
+	mpz_abs(k, k);
+	while(mpz_sgn(k) != 0){
+		unsigned long step = mpz_fits_ulong_p(k) ? mpz_get_ui(k) : LONG_MAX;
+		if(negative){
+			mpf_div_2exp(*res, *res, step);
+		} else {
+			mpf_mul_2exp(*res, *res, step);
+		}
+		mpz_sub_ui(k, k, step);
+	}
+	mpz_clear(k);
+}
+
 mpf_t* Exp(mpf_t* v){
 	if(IsUndefined(v))return GetUndefined();
 	if(IsPlusInfinity(v))return GetPlusInfinity();
 	if(IsMinusInfinity(v))return ToMpft(0.0);
-	if(Compare(v, -1.0) < 0 || Compare(v, 1.0) > 0){
-		mpf_t* v_half = Multiply2Exp(v, -1);
-		mpf_t* res_half = Exp(v_half);
-		mpf_t* res = Multiply(res_half, res_half);
-		ReleaseValue(v_half);
-		ReleaseValue(res_half);
-		return res;
-	} else {
-		return exp_taylor(v);
+	if(mpf_sgn(*v) == 0)return ToMpft(1.0);
+	if(expOverflows(v))return (mpf_sgn(*v) > 0 ? GetPlusInfinity() : ToMpft(0.0));
+	mpf_t* res = GetResultPointer();
+	expFinite(res, v, mpf_get_default_prec());
+	return res;
+}
+
+mpf_t* Exp(mpf_t* dst, mpf_t* v){
+	return replaceDestination(dst, Exp(v));
+}
+
+// LogE divides the mantissa of its argument by (LOG_TABLE_DENOMINATOR + j) / LOG_TABLE_DENOMINATOR for the closest j
+// in [LOG_TABLE_MINIMAL_INDEX, LOG_TABLE_MAXIMAL_INDEX], such that the remaining value differs from 1 by at most 1 / 128.
+const long LOG_TABLE_DENOMINATOR = 64;
+const long LOG_TABLE_MINIMAL_INDEX = -16;
+const long LOG_TABLE_MAXIMAL_INDEX = 32;
+
+// ln((LOG_TABLE_DENOMINATOR + j) / LOG_TABLE_DENOMINATOR) with two additional limbs.
+std::vector<mpf_t*> calculate_log_table(mp_bitcnt_t precision){
+	std::vector<mpf_t*> res;
+	for(long j = LOG_TABLE_MINIMAL_INDEX; j <= LOG_TABLE_MAXIMAL_INDEX; j++){
+		res.push_back(constantcalculation::CalculateLogRatioIncrementally(LOG_TABLE_DENOMINATOR + j, LOG_TABLE_DENOMINATOR,
+				precision + 2 * GMP_NUMB_BITS));
 	}
+	return res;
 }
 
-mpf_t* logE_taylor(mpf_t* v){
-	mpf_t* n1 = ToMpft(1.0);
-	mpf_t* x = Subtract(n1, v);
-	mpf_t* res = Negate(x);
-	mpf_t* n = Clone(n1);
-	mpf_t* factor = Negate(x);
+PrecisionDependentValues log_table_cached_(calculate_log_table, true);
+
+// Calculates res = ln(m) for 0.75 <= m < 1.5 with a table lookup and the series of atanh.
+void logESeries(mpf_t* res, mpf_t* m, mp_bitcnt_t precision){
+	long j = std::lround((mpf_get_d(*m) - 1.0) * LOG_TABLE_DENOMINATOR);
+	j = std::max(LOG_TABLE_MINIMAL_INDEX, std::min(LOG_TABLE_MAXIMAL_INDEX, j));
+	mpf_t* t = getResultPointer(precision);
+	if(j != 0){
+		mpf_mul_ui(*t, *m, LOG_TABLE_DENOMINATOR);
+		mpf_div_ui(*t, *t, LOG_TABLE_DENOMINATOR + j);
+	} else {
+		mpf_set(*t, *m);
+	}
+	// ln(t) = 2 atanh((t - 1) / (t + 1))
+	mpf_t* denominator = getResultPointer(precision);
+	mpf_add_ui(*denominator, *t, 1);
+	mpf_sub_ui(*t, *t, 1);
+	if(mpf_sgn(*t) == 0){
+		mpf_set_ui(*res, 0);
+	} else {
+		mpf_div(*t, *t, *denominator);
+		long z_exponent;
+		mpf_get_d_2exp(&z_exponent, *t);
+		inverseTangentSeries(res, t, z_exponent, true, precision);
+		mpf_mul_2exp(*res, *res, 1);
+	}
+	if(j != 0){
+		mpf_add(*res, *res, *log_table_cached_.Get()[j - LOG_TABLE_MINIMAL_INDEX]);
+	}
+	ReleaseValue(t);
+	ReleaseValue(denominator);
+}
+
+// Calculates res = ln(m) + k ln(2) for 0.75 <= m < 1.5 with the arithmetic-geometric mean.
+// ln(s) = pi / (2 AGM(1, 4 / s)) + O(1 / s^2) is used for s = m 2^shift > 2^(precision / 2).
+void logEAgm(mpf_t* res, mpf_t* m, long k, mp_bitcnt_t precision){
+	long shift = precision / 2 + 2;
+	mpf_t* a = getResultPointer(precision);
+	mpf_t* b = getResultPointer(precision);
+	mpf_t* next_a = getResultPointer(precision);
+	mpf_set_ui(*a, 1);
+	mpf_ui_div(*b, 4, *m);
+	mpf_div_2exp(*b, *b, shift);
 	while(true){
-		mpf_t* tmp = Multiply(factor, x);
-		std::swap(tmp, factor);
-		ReleaseValue(tmp);
-		tmp = Add(n, n1);
-		std::swap(n, tmp);
-		ReleaseValue(tmp);
-		mpf_t* part = Divide(factor, n);
-		mpf_t* nres = add_NO_CHECK(res, part);
-		ReleaseValue(part);
-		bool same = (mpf_cmp(*nres, *res) == 0);
-		ReleaseValue(res);
-		res = nres;
-		if(same)break;
+		mpf_add(*next_a, *a, *b);
+		mpf_div_2exp(*next_a, *next_a, 1);
+		mpf_mul(*b, *a, *b);
+		mpf_sqrt(*b, *b);
+		std::swap(a, next_a);
+		mpf_sub(*next_a, *a, *b);
+		if(mpf_sgn(*next_a) == 0)break;
+		long a_exponent;
+		long difference_exponent;
+		mpf_get_d_2exp(&a_exponent, *a);
+		mpf_get_d_2exp(&difference_exponent, *next_a);
+		// the arithmetic-geometric mean converges quadratically,
+		// hence the next arithmetic mean differs from the limit by at most (a - b)^2 / a
+		if(2 * (difference_exponent - a_exponent) < -(long)precision)break;
+	}
+	mpf_add(*a, *a, *b);
+	mpf_div(*res, *pi_cached_.Get()[0], *a);
+	k -= shift;
+	mpf_mul_ui(*a, *ln2_cached_.Get()[0], std::labs(k));
+	if(k > 0){
+		mpf_add(*res, *res, *a);
+	} else {
+		mpf_sub(*res, *res, *a);
+	}
+	ReleaseValue(a);
+	ReleaseValue(b);
+	ReleaseValue(next_a);
+}
+
+// Decides whether the natural logarithm is calculated with the arithmetic-geometric mean
+// (see Configuration::getLogarithmAlgorithm).
+bool useLogAgm(mp_bitcnt_t precision){
+	switch(Configuration::getLogarithmAlgorithm()){
+	case configuration::LOGARITHM_ALGORITHM_SERIES:
+		return false;
+	case configuration::LOGARITHM_ALGORITHM_AGM:
+		return true;
+	default:
+		return precision >= Configuration::getLogAgmMinimalPrecision();
+	}
+}
+
+// Calculates res = ln(v) for finite v > 0 with a relative error of about 2^-precision.
+// The precision may exceed the default precision by at most GMP_NUMB_BITS,
+// because the cached constants carry only two additional limbs.
+void logEPositive(mpf_t* res, mpf_t* v, mp_bitcnt_t precision){
+	// ln(v) = ln(m) + k ln(2) with v = m 2^k and 0.75 <= m < 1.5
+	mp_bitcnt_t working_precision = precision + GMP_NUMB_BITS;
+	long k;
+	mpf_get_d_2exp(&k, *v);
+	mpf_t* m = getResultPointer(std::max(working_precision, mpf_get_prec(*v)));
+	if(k >= 0){
+		mpf_div_2exp(*m, *v, k);
+	} else {
+		mpf_mul_2exp(*m, *v, -k);
+	}
+	if(mpf_cmp_d(*m, 0.75) < 0){
+		mpf_mul_2exp(*m, *m, 1);
+		k--;
+	}
+	// the arithmetic-geometric mean cancels bits if m is close to 1,
+	// the guard bits of the cached constants limit the number of bits which may cancel
+	long cancelled_bits = 0;
+	if(k == 0){
+		mpf_t* difference = getResultPointer(mpf_get_prec(*m));
+		mpf_sub_ui(*difference, *m, 1);
+		if(mpf_sgn(*difference) != 0){
+			mpf_get_d_2exp(&cancelled_bits, *difference);
+			cancelled_bits = std::max(0L, -cancelled_bits);
+		}
+		ReleaseValue(difference);
+	}
+	long guard_bits = GMP_NUMB_BITS - std::max(0L, (long)precision - (long)mpf_get_default_prec());
+	mpf_t* tmp = NULL;
+	if(useLogAgm(precision) && cancelled_bits < guard_bits){
+		// the result is the difference of two values of size about precision / 2
+		working_precision += cancelled_bits + (mp_bitcnt_t)std::log2((double)precision);
+		tmp = getResultPointer(working_precision);
+		logEAgm(tmp, m, k, working_precision);
+	} else {
+		tmp = getResultPointer(working_precision);
+		logESeries(tmp, m, working_precision);
+		if(k != 0){
+			mpf_t* multiple = getResultPointer(working_precision);
+			mpf_mul_ui(*multiple, *ln2_cached_.Get()[0], std::labs(k));
+			if(k > 0){
+				mpf_add(*tmp, *tmp, *multiple);
+			} else {
+				mpf_sub(*tmp, *tmp, *multiple);
+			}
+			ReleaseValue(multiple);
+		}
 	}
-	ReleaseValue(n1);
-	ReleaseValue(x);
-	ReleaseValue(n);
-	ReleaseValue(factor);
-	return res;
+	ReleaseValue(m);
+	mpf_set(*res, *tmp);
+	ReleaseValue(tmp);
 }
 
 mpf_t* LogE(mpf_t* v){
@@ -1664,18 +2177,544 @@ mpf_t* LogE(mpf_t* v){
 	if(IsMinusInfinity(v))return GetUndefined();
 	if(Compare(v, 0.0) < 0)return GetUndefined();
 	if(Compare(v, 0.0) ==  0)return GetMinusInfinity();
-	if(Compare(v, 0.99) < 0 || Compare(v, 1.01) > 0){
-		mpf_t* sqv = Sqrt(v);
-		mpf_t* n2 = ToMpft(2);
-		mpf_t* res_sq = LogE(sqv);
-		mpf_t* res = Multiply(n2, res_sq);
-		ReleaseValue(res_sq);
-		ReleaseValue(sqv);
-		ReleaseValue(n2);
-		return res;
+	mpf_t* res = GetResultPointer();
+	logEPositive(res, v, mpf_get_default_prec());
+	return res;
+}
+
+mpf_t* LogE(mpf_t* dst, mpf_t* v){
+	return replaceDestination(dst, LogE(v));
+}
+
+// Calculates res = sinh(v) with the Taylor series for |v| < 2^log2_v <= 1/2.
+// The series sinh(v) / v = sum_n (v^2)^n / (2n + 1)! is evaluated by hypergeometricSeries.
+void sinhSeries(mpf_t* res, mpf_t* v, double log2_v, mp_bitcnt_t precision){
+	// number of terms such that the last term v^(2 terms - 2) / (2 terms - 1)! < 2^-(precision + 2),
+	// for v^2 <= 1/4 the omitted terms sum up to less than twice this bound
+	unsigned long terms = 1;
+	double log2_term = 0;
+	while(log2_term > -(double)precision - 2){
+		log2_term += 2 * log2_v - std::log2(2.0 * terms * (2 * terms + 1));
+		terms++;
+	}
+	mpf_t* w = getResultPointer(precision);
+	mpf_mul(*w, *v, *v);
+	hypergeometricSeries(res, w, terms, sinDivisor, precision);
+	mpf_mul(*res, *res, *v);
+	ReleaseValue(w);
+}
+
+// Calculates sinh(v) and cosh(v) for finite v with a relative error of about 2^-precision, where exp(|v|) must not overflow.
+// Only the values with a destination are stored, the other destination may be NULL.
+// For |v| >= 1/2 both values are derived from one evaluation of e = exp(|v|):
+// sinh(|v|) = (e - 1 / e) / 2 cancels less than one bit and cosh(|v|) = (e + 1 / e) / 2.
+// For |v| < 1/2 the series of sinh is used and cosh(v) = sqrt(1 + sinh(v)^2) has no cancellation.
+void sinhCoshFinite(mpf_t* sinh_res, mpf_t* cosh_res, mpf_t* v, mp_bitcnt_t precision){
+	mp_bitcnt_t working_precision = precision + GMP_NUMB_BITS;
+	mpf_t* a = getResultPointer(std::max(working_precision, mpf_get_prec(*v)));
+	mpf_t* sinh_a = getResultPointer(working_precision);
+	mpf_t* cosh_a = getResultPointer(working_precision);
+	mpf_abs(*a, *v);
+	long a_exponent = 0;
+	if(mpf_sgn(*a) != 0){
+		mpf_get_d_2exp(&a_exponent, *a);
+	}
+	if(mpf_sgn(*a) == 0){
+		mpf_set_ui(*sinh_a, 0);
+		mpf_set_ui(*cosh_a, 1);
+	} else if(a_exponent < 0){
+		sinhSeries(sinh_a, a, a_exponent, working_precision);
+		if(cosh_res != NULL){
+			mpf_mul(*cosh_a, *sinh_a, *sinh_a);
+			mpf_add_ui(*cosh_a, *cosh_a, 1);
+			mpf_sqrt(*cosh_a, *cosh_a);
+		}
+	} else {
+		expFinite(cosh_a, a, working_precision);
+		mpf_ui_div(*sinh_a, 1, *cosh_a);
+		// cosh_a = e - 1 / e and sinh_a = e + 1 / e, which are swapped afterwards
+		mpf_sub(*cosh_a, *cosh_a, *sinh_a);
+		mpf_mul_2exp(*sinh_a, *sinh_a, 1);
+		mpf_add(*sinh_a, *cosh_a, *sinh_a);
+		std::swap(sinh_a, cosh_a);
+		mpf_div_2exp(*sinh_a, *sinh_a, 1);
+		mpf_div_2exp(*cosh_a, *cosh_a, 1);
+	}
+	if(sinh_res != NULL){
+		mpf_set(*sinh_res, *sinh_a);
+		if(mpf_sgn(*v) < 0) mpf_neg(*sinh_res, *sinh_res);
+	}
+	if(cosh_res != NULL){
+		mpf_set(*cosh_res, *cosh_a);
+	}
+	ReleaseValue(a);
+	ReleaseValue(sinh_a);
+	ReleaseValue(cosh_a);
+}
+
+mpf_t* Sinh(mpf_t* v){
+	if(IsUndefined(v))return GetUndefined();
+	if(IsPlusInfinity(v))return GetPlusInfinity();
+	if(IsMinusInfinity(v))return GetMinusInfinity();
+	// exp(|v|) is not representable, hence sinh(v) overflows as well
+	if(expOverflows(v))return (mpf_sgn(*v) > 0 ? GetPlusInfinity() : GetMinusInfinity());
+	mpf_t* res = GetResultPointer();
+	sinhCoshFinite(res, NULL, v, mpf_get_default_prec());
+	return res;
+}
+
+mpf_t* Sinh(mpf_t* dst, mpf_t* v){
+	return replaceDestination(dst, Sinh(v));
+}
+
+mpf_t* Cosh(mpf_t* v){
+	if(IsUndefined(v))return GetUndefined();
+	if(IsInfinite(v) || expOverflows(v))return GetPlusInfinity();
+	mpf_t* res = GetResultPointer();
+	sinhCoshFinite(NULL, res, v, mpf_get_default_prec());
+	return res;
+}
+
+mpf_t* Cosh(mpf_t* dst, mpf_t* v){
+	return replaceDestination(dst, Cosh(v));
+}
+
+std::pair<mpf_t*, mpf_t*> SinhCosh(mpf_t* v){
+	if(IsUndefined(v))return std::make_pair(GetUndefined(), GetUndefined());
+	if(IsInfinite(v) || expOverflows(v))return std::make_pair(Sinh(v), GetPlusInfinity());
+	std::pair<mpf_t*, mpf_t*> res(GetResultPointer(), GetResultPointer());
+	sinhCoshFinite(res.first, res.second, v, mpf_get_default_prec());
+	return res;
+}
+
+std::pair<mpf_t*, mpf_t*> SinhCosh(mpf_t* dst_sinh, mpf_t* dst_cosh, mpf_t* v){
+	std::pair<mpf_t*, mpf_t*> res = SinhCosh(v);
+	res.first = replaceDestination(dst_sinh, res.first);
+	res.second = replaceDestination(dst_cosh, res.second);
+	return res;
+}
+
+mpf_t* Tanh(mpf_t* v){
+	if(IsUndefined(v))return GetUndefined();
+	if(IsPlusInfinity(v))return ToMpft(1.0);
+	if(IsMinusInfinity(v))return ToMpft(-1.0);
+	mp_bitcnt_t precision = mpf_get_default_prec();
+	// tanh(|v|) = 1 - 2 / (exp(2 |v|) + 1) rounds to 1 for large |v|, where exp(|v|) would be needlessly expensive
+	if(std::abs(mpf_get_d(*v)) > (precision + 2) * M_LN2 / 2){
+		return ToMpft(mpf_sgn(*v) > 0 ? 1.0 : -1.0);
+	}
+	mp_bitcnt_t working_precision = precision + GMP_NUMB_BITS;
+	mpf_t* sinh_v = getResultPointer(working_precision);
+	mpf_t* cosh_v = getResultPointer(working_precision);
+	sinhCoshFinite(sinh_v, cosh_v, v, precision);
+	mpf_t* res = GetResultPointer();
+	mpf_div(*res, *sinh_v, *cosh_v);
+	ReleaseValue(sinh_v);
+	ReleaseValue(cosh_v);
+	return res;
+}
+
+mpf_t* Tanh(mpf_t* dst, mpf_t* v){
+	return replaceDestination(dst, Tanh(v));
+}
+
+// Calculates res = atanh(z) for |z| < 1 with a relative error of about 2^-precision.
+// For |z| <= 1/2 the series is used after halving the argument (see atanReduced),
+// which avoids the cancellation of ln((1 + z) / (1 - z)) / 2 for small arguments.
+// Otherwise atanh(|z|) = ln((1 + |z|) / (1 - |z|)) / 2, where the logarithm is at least ln(3).
+void atanhFinite(mpf_t* res, mpf_t* z, mp_bitcnt_t precision){
+	mp_bitcnt_t working_precision = precision + GMP_NUMB_BITS;
+	mpf_t* t = getResultPointer(std::max(working_precision, mpf_get_prec(*z)));
+	mpf_t* tmp = getResultPointer(working_precision);
+	mpf_abs(*t, *z);
+	if(mpf_cmp_d(*t, 0.5) <= 0){
+		atanReduced(tmp, t, true, working_precision);
+	} else {
+		mpf_ui_sub(*tmp, 1, *t);
+		mpf_add_ui(*t, *t, 1);
+		mpf_div(*t, *t, *tmp);
+		logEPositive(tmp, t, working_precision);
+		mpf_div_2exp(*tmp, *tmp, 1);
+	}
+	mpf_set(*res, *tmp);
+	if(mpf_sgn(*z) < 0) mpf_neg(*res, *res);
+	ReleaseValue(t);
+	ReleaseValue(tmp);
+}
+
+mpf_t* Asinh(mpf_t* v){
+	if(IsUndefined(v))return GetUndefined();
+	if(IsPlusInfinity(v))return GetPlusInfinity();
+	if(IsMinusInfinity(v))return GetMinusInfinity();
+	mp_bitcnt_t precision = mpf_get_default_prec();
+	mp_bitcnt_t working_precision = precision + GMP_NUMB_BITS;
+	mpf_t* res = GetResultPointer();
+	mpf_t* t = getResultPointer(std::max(working_precision, mpf_get_prec(*v)));
+	mpf_t* root = getResultPointer(working_precision);
+	mpf_abs(*t, *v);
+	mpf_mul(*root, *t, *t);
+	mpf_add_ui(*root, *root, 1);
+	mpf_sqrt(*root, *root);
+	if(mpf_cmp_d(*t, 0.5) <= 0){
+		// asinh(x) = atanh(x / sqrt(x^2 + 1)), where the quotient is at most 1 / sqrt(5)
+		mpf_div(*t, *v, *root);
+		atanhFinite(res, t, precision);
 	} else {
-		return logE_taylor(v);
+		// asinh(|x|) = ln(|x| + sqrt(x^2 + 1)), where the argument of the logarithm is larger than 1.6
+		mpf_add(*t, *t, *root);
+		logEPositive(root, t, working_precision);
+		mpf_set(*res, *root);
+		if(mpf_sgn(*v) < 0) mpf_neg(*res, *res);
+	}
+	ReleaseValue(t);
+	ReleaseValue(root);
+	return res;
+}
+
+mpf_t* Asinh(mpf_t* dst, mpf_t* v){
+	return replaceDestination(dst, Asinh(v));
+}
+
+mpf_t* Acosh(mpf_t* v){
+	if(IsUndefined(v))return GetUndefined();
+	if(IsPlusInfinity(v))return GetPlusInfinity();
+	if(IsMinusInfinity(v))return GetUndefined();
+	if(Compare(v, 1.0) < 0)return GetUndefined();
+	if(Compare(v, 1.0) == 0)return ToMpft(0.0);
+	mp_bitcnt_t precision = mpf_get_default_prec();
+	mp_bitcnt_t working_precision = precision + GMP_NUMB_BITS;
+	mpf_t* res = GetResultPointer();
+	// x - 1 is exact, because the precision of t is at least the precision of x
+	mpf_t* t = getResultPointer(std::max(working_precision, mpf_get_prec(*v)));
+	mpf_t* factor = getResultPointer(working_precision);
+	mpf_sub_ui(*t, *v, 1);
+	mpf_add_ui(*factor, *v, 1);
+	if(Compare(v, 1.5) <= 0){
+		// acosh(x) = 2 atanh(sqrt((x - 1) / (x + 1))), where the argument of atanh is at most 1 / sqrt(5)
+		mpf_div(*t, *t, *factor);
+		mpf_sqrt(*t, *t);
+		atanhFinite(res, t, precision);
+		mpf_mul_2exp(*res, *res, 1);
+	} else {
+		// acosh(x) = ln(x + sqrt((x - 1) (x + 1))), where the argument of the logarithm is larger than 2.6
+		mpf_mul(*t, *t, *factor);
+		mpf_sqrt(*t, *t);
+		mpf_add(*t, *t, *v);
+		logEPositive(factor, t, working_precision);
+		mpf_set(*res, *factor);
+	}
+	ReleaseValue(t);
+	ReleaseValue(factor);
+	return res;
+}
+
+mpf_t* Acosh(mpf_t* dst, mpf_t* v){
+	return replaceDestination(dst, Acosh(v));
+}
+
+mpf_t* Atanh(mpf_t* v){
+	if(IsUndefined(v) || IsInfinite(v))return GetUndefined();
+	if(Compare(v, -1.0) < 0 || Compare(v, 1.0) > 0)return GetUndefined();
+	if(Compare(v, 1.0) == 0)return GetPlusInfinity();
+	if(Compare(v, -1.0) == 0)return GetMinusInfinity();
+	mpf_t* res = GetResultPointer();
+	atanhFinite(res, v, mpf_get_default_prec());
+	return res;
+}
+
+mpf_t* Atanh(mpf_t* dst, mpf_t* v){
+	return replaceDestination(dst, Atanh(v));
+}
+
+// Each algorithm is timed in TUNING_BATCHES batches of calls which take at least TUNING_MINIMAL_BATCH_SECONDS each.
+const int TUNING_BATCHES = 3;
+const double TUNING_MINIMAL_BATCH_SECONDS = 0.002;
+
+void tuningSinCos(mpf_t* v){
+	std::pair<mpf_t*, mpf_t*> res = SinCos(v);
+	ReleaseValue(res.first);
+	ReleaseValue(res.second);
+}
+
+void tuningLogE(mpf_t* v){
+	ReleaseValue(LogE(v));
+}
+
+// Returns the time in seconds of one call of calculate with the current configuration.
+// The first call is not timed, because it calculates the cached values for the current precision.
+// The fastest batch is used, because interruptions only slow down the calls.
+double tuningSeconds(void (*calculate)(mpf_t* v), mpf_t* v){
+	calculate(v);
+	double best = 0;
+	for(int batch = 0; batch < TUNING_BATCHES; batch++){
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		double seconds = 0;
+		int calls = 0;
+		while(seconds < TUNING_MINIMAL_BATCH_SECONDS){
+			calculate(v);
+			calls++;
+			seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		}
+		if(batch == 0 || seconds / calls < best){
+			best = seconds / calls;
+		}
 	}
+	return best;
+}
+
+void TuneAlgorithms(const std::vector<mp_bitcnt_t> & precisions){
+	std::vector<mp_bitcnt_t> grid(precisions);
+	std::sort(grid.begin(), grid.end());
+	mp_bitcnt_t previous_precision = mpf_get_default_prec();
+	unsigned long cordic_minimal_precision = ULONG_MAX;
+	unsigned long log_agm_minimal_precision = ULONG_MAX;
+	bool cordic_faster = true;
+	bool log_agm_faster = true;
+	for(unsigned int i = grid.size(); i-- > 0;){
+		mpf_set_default_prec(grid[i]);
+		// the arguments need no argument reduction beyond the reduction which every argument passes
+		mpf_t* angle = ToMpft(0.7);
+		mpf_t* logarithm_argument = ToMpft(2.7);
+		Configuration::setTrigonometricAlgorithm(configuration::TRIGONOMETRIC_ALGORITHM_TAYLOR);
+		double taylor_seconds = tuningSeconds(tuningSinCos, angle);
+		Configuration::setTrigonometricAlgorithm(configuration::TRIGONOMETRIC_ALGORITHM_CORDIC);
+		double cordic_seconds = tuningSeconds(tuningSinCos, angle);
+		Configuration::setLogarithmAlgorithm(configuration::LOGARITHM_ALGORITHM_SERIES);
+		double series_seconds = tuningSeconds(tuningLogE, logarithm_argument);
+		Configuration::setLogarithmAlgorithm(configuration::LOGARITHM_ALGORITHM_AGM);
+		double agm_seconds = tuningSeconds(tuningLogE, logarithm_argument);
+		ReleaseValue(angle);
+		ReleaseValue(logarithm_argument);
+		cordic_faster = cordic_faster && cordic_seconds < taylor_seconds;
+		if(cordic_faster) cordic_minimal_precision = grid[i];
+		log_agm_faster = log_agm_faster && agm_seconds < series_seconds;
+		if(log_agm_faster) log_agm_minimal_precision = grid[i];
+	}
+	mpf_set_default_prec(previous_precision);
+	Configuration::setTrigonometricAlgorithm(configuration::TRIGONOMETRIC_ALGORITHM_AUTOMATIC);
+	Configuration::setCordicMinimalPrecision(cordic_minimal_precision);
+	Configuration::setLogarithmAlgorithm(configuration::LOGARITHM_ALGORITHM_AUTOMATIC);
+	Configuration::setLogAgmMinimalPrecision(log_agm_minimal_precision);
+}
+
+void TuneAlgorithms(){
+	std::vector<mp_bitcnt_t> precisions;
+	for(mp_bitcnt_t precision = 256; precision <= 16384; precision *= 2){
+		precisions.push_back(precision);
+	}
+	TuneAlgorithms(precisions);
+}
+
+mpf_t* Pow(mpf_t* v, double p){
+	if(IsUndefined(v)){
+		return GetUndefined();
+	}
+	if(IsInfinite(v)){
+		if(p < 0){
+			return ToMpft(0.0);
+		} else if(p == 0){
+			return ToMpft(1.0);
+		} else if(IsPlusInfinity(v)){
+			return GetPlusInfinity();
+		} else {
+			long long pp = p;
+			if(pp - p == 0){
+				if(pp % 2 == 0)return GetPlusInfinity();
+				else return GetMinusInfinity();
+			} else {
+				return GetUndefined();
+			}
+		}
+	}
+	mpf_t* tmp = ToMpft(p);
+	mpf_t* res = Pow(v, tmp);
+	ReleaseValue(tmp);
+	return res;
+}
+
+mpf_t* Pow(mpf_t* dst, mpf_t* v, double p){
+	return replaceDestination(dst, Pow(v, p));
+}
+
+// Calculates res = value^exponent by binary powering, starting at the most significant bit of the exponent.
+// Every intermediate value is a power value^i with i <= exponent, which needs at most as many bits as value^exponent.
+// Hence the result is exact if value^exponent fits into the precision of res.
+void powInteger(mpf_t* res, mpf_t* value, unsigned long exponent){
+	if(exponent == 0){
+		mpf_set_ui(*res, 1);
+		return;
+	}
+	int bit = 0;
+	while((exponent >> bit) > 1){
+		bit++;
+	}
+	mpf_set(*res, *value);
+	while(bit-- > 0){
+		mpf_mul(*res, *res, *res);
+		if((exponent >> bit) & 1){
+			mpf_mul(*res, *res, *value);
+		}
+	}
+}
+
+// Calculates res = value^exponent for value != 0 and exponent = sign * magnitude.
+// The result is exact if value^magnitude and the result fit into the precision of res.
+void powIntegerSigned(mpf_t* res, mpf_t* value, int sign, unsigned long magnitude){
+	mpf_t* power = getResultPointer(std::max(mpf_get_prec(*res), mpf_get_prec(*value)) + GMP_NUMB_BITS);
+	powInteger(power, value, magnitude);
+	if(sign < 0){
+		mpf_ui_div(*res, 1, *power);
+	} else {
+		mpf_set(*res, *power);
+	}
+	ReleaseValue(power);
+}
+
+mpf_t* Pow(mpf_t* v, int p) {
+	if(IsUndefined(v)){
+		return GetUndefined();
+	}
+	if(IsInfinite(v)){
+		if(p < 0){
+			return ToMpft(0.0);
+		} else if(p == 0){
+			return ToMpft(1.0);
+		} else if(IsPlusInfinity(v)){
+			return GetPlusInfinity();
+		} else {
+			if(p % 2 == 0)return GetPlusInfinity();
+			else return GetMinusInfinity();
+		}
+	}
+	if(p == 0){
+		return ToMpft(1.0);
+	}
+	if(mpf_sgn(*v) == 0){
+		return (p < 0) ? GetUndefined() : ToMpft(0.0);
+	}
+	// not using mpf_pow_ui because it produces different output on different versions!!
+	mpf_t* res = GetResultPointer();
+	powIntegerSigned(res, v, p, std::labs((long)p));
+	return res;
+}
+
+mpf_t* Pow(mpf_t* dst, mpf_t* v, int p){
+	return replaceDestination(dst, Pow(v, p));
+}
+
+// The fractional part of the exponent is handled with ln and exp at this many bits above the default precision.
+const mp_bitcnt_t POW_GUARD_BITS = GMP_NUMB_BITS / 2;
+
+// Fractional parts of exponents with at most this many binary digits are handled with repeated square roots,
+// which are much cheaper than ln and exp.
+const int POW_MAXIMAL_SQUARE_ROOTS = 8;
+
+mpf_t* Pow(mpf_t* v, mpf_t* p) {
+	if(IsUndefined(v) || IsUndefined(p)){
+		return GetUndefined();
+	}
+	if(IsInfinite(p)){
+		return GetUndefined();
+	}
+	if(IsInfinite(v)){
+		if(Compare(p,0.0) < 0){
+			return ToMpft(0.0);
+		} else if(Compare(p, 0.0) == 0){
+			return ToMpft(1.0);
+		} else if(IsPlusInfinity(v)){
+			return GetPlusInfinity();
+		} else {
+			return GetUndefined();
+		}
+	}
+	if(Compare(p, 0.0) == 0) {
+		return ToMpft(1.0);
+	}
+	if(Compare(v, 0.0) == 0) {
+		return ToMpft(0.0);
+	}
+	if(Compare(v, 1.0) == 0) {
+		return ToMpft(1.0);
+	}
+	// v^p = v^n exp(f ln(v)) with the integral part n and the fractional part f of p, which have the same sign
+	mpf_t* n = getResultPointer(mpf_get_prec(*p));
+	mpf_t* f = getResultPointer(mpf_get_prec(*p));
+	mpf_trunc(*n, *p);
+	mpf_sub(*f, *p, *n);
+	if(mpf_sgn(*f) != 0 && mpf_sgn(*v) < 0){
+		ReleaseValue(n);
+		ReleaseValue(f);
+		return GetUndefined();
+	}
+	mpf_abs(*n, *n);
+	mp_bitcnt_t precision = mpf_get_default_prec() + POW_GUARD_BITS;
+	mpf_t* res = getResultPointer(precision);
+	if(mpf_fits_ulong_p(*n)){
+		powIntegerSigned(res, v, mpf_sgn(*p), mpf_get_ui(*n));
+		if(mpf_sgn(*f) != 0){
+			// |f| = m / 2^k with few binary digits k is handled with k square roots, otherwise exp(|f| ln(v)) is used
+			mpf_t* factor = getResultPointer(precision + GMP_NUMB_BITS);
+			mpf_abs(*f, *f);
+			int square_roots = 1;
+			mpf_mul_2exp(*factor, *f, 1);
+			while(square_roots < POW_MAXIMAL_SQUARE_ROOTS && !mpf_integer_p(*factor)){
+				mpf_mul_2exp(*factor, *factor, 1);
+				square_roots++;
+			}
+			if(mpf_integer_p(*factor)){
+				// the rounding error of the root is multiplied by at most 2^square_roots
+				mpf_t* root = getResultPointer(precision + GMP_NUMB_BITS);
+				mpf_sqrt(*root, *v);
+				for(int i = 1; i < square_roots; i++){
+					mpf_sqrt(*root, *root);
+				}
+				powInteger(factor, root, mpf_get_ui(*factor));
+				ReleaseValue(root);
+			} else {
+				logEPositive(factor, v, precision);
+				mpf_mul(*factor, *factor, *f);
+				expFinite(factor, factor, precision);
+			}
+			if(mpf_sgn(*p) < 0){
+				mpf_div(*res, *res, *factor);
+			} else {
+				mpf_mul(*res, *res, *factor);
+			}
+			ReleaseValue(factor);
+		}
+	} else {
+		// |p| > ULONG_MAX, hence v^p = +-exp(p ln(|v|)) where the sign depends on the parity of the integer p
+		mpf_div_2exp(*n, *n, 1);
+		bool negative = (mpf_sgn(*v) < 0 && !mpf_integer_p(*n));
+		mpf_t* tmp = getResultPointer(std::max(precision, mpf_get_prec(*v)));
+		mpf_abs(*tmp, *v);
+		logEPositive(tmp, tmp, precision);
+		mpf_mul(*tmp, *tmp, *p);
+		if(expOverflows(tmp)){
+			bool overflow = (mpf_sgn(*tmp) > 0);
+			ReleaseValue(tmp);
+			ReleaseValue(n);
+			ReleaseValue(f);
+			ReleaseValue(res);
+			if(!overflow)return ToMpft(0.0);
+			return negative ? GetMinusInfinity() : GetPlusInfinity();
+		}
+		expFinite(res, tmp, precision);
+		if(negative){
+			mpf_neg(*res, *res);
+		}
+		ReleaseValue(tmp);
+	}
+	ReleaseValue(n);
+	ReleaseValue(f);
+	mpf_t* rounded = GetResultPointer();
+	mpf_set(*rounded, *res);
+	ReleaseValue(res);
+	return rounded;
+}
+
+mpf_t* Pow(mpf_t* dst, mpf_t* v, mpf_t* p){
+	return replaceDestination(dst, Pow(v, p));
 }
 
 double Log2Double(mpf_t* v) {
@@ -1698,29 +2737,20 @@ std::string MpftToString(mpf_t* v){
 	if(IsUndefined(v))return "nan";
 	if(IsPlusInfinity(v))return "inf";
 	if(IsMinusInfinity(v))return "-inf";
-	static char* buf = NULL;
-	static int buf_size = 0;
-	if(buf == NULL){
-		AssertCondition(buf_size == 0, "Initialization failed.");
-		buf_size = 10;
-		buf = (char*) malloc(buf_size * sizeof(char));
-	}
-	AssertCondition(buf_size != 0, "Initialization failed.");
+	static thread_local std::vector<char> buf(10);
 	int string_size;
 	int output_precision = Configuration::getOutputPrecision();
 	if(output_precision == -1){
 		output_precision = mpf_get_default_prec() / log(10.0) * log(2.0);
 	}
 	while (true) {
-		string_size = gmp_snprintf(buf, buf_size, "%.*Fe", output_precision, *v);
-		if( string_size < buf_size ){
+		string_size = gmp_snprintf(buf.data(), buf.size(), "%.*Fe", output_precision, *v);
+		if( string_size < (int)buf.size() ){
 			break;
 		}
-		free (buf);
-		buf_size *= 2;
-		buf = (char*) malloc(buf_size * sizeof(char));
+		buf.resize(buf.size() * 2);
 	}
-	AssertCondition(string_size == (int)strlen(buf), "");
+	AssertCondition(string_size == (int)strlen(buf.data()), "");
 	if(Configuration::getOutputPrecision() == -1){
 		int e_pos = string_size - 1;
 		while(e_pos > 0 && buf[e_pos] != 'e')--e_pos;
@@ -1733,7 +2763,7 @@ std::string MpftToString(mpf_t* v){
 			}
 		}
 	}
-	std::string res(buf);
+	std::string res(buf.data());
 	return res;
 }
 
@@ -1774,12 +2804,18 @@ mpf_t* LoadMpft(std::ifstream* file){
 	if ( part == "nan" ) {
 		return GetUndefined();
 	}
-	mpf_t* a = GetResultPointer();
+	int size;
+	mp_size_t prec;
+	mp_exp_t exp;
 	std::istringstream is_part(part);
-	is_part >> (*a)->_mp_size;
-	(*file) >> (*a)->_mp_prec >> (*a)->_mp_exp;
-	AssertCondition(std::abs((*a)->_mp_size) <= (*a)->_mp_prec + 1, "Load of mpf_t failed.");
-	(*a)->_mp_d = (mp_limb_t*) malloc(((*a)->_mp_prec + 1) * sizeof(mp_limb_t));
+	is_part >> size;
+	(*file) >> prec >> exp;
+	AssertCondition(prec >= 2 && std::abs(size) <= prec + 1, "Load of mpf_t failed.");
+	// the limbs of the supplied mpf_t are allocated with exactly the stored precision
+	mpf_t* a = getResultPointer((prec - 1) * GMP_NUMB_BITS);
+	AssertCondition((*a)->_mp_prec == prec, "Load of mpf_t failed.");
+	(*a)->_mp_size = size;
+	(*a)->_mp_exp = exp;
 	for(int i = 0; i < std::abs((*a)->_mp_size); i++){
 		(*file) >> (*a)->_mp_d[i];
 	}
@@ -42,6 +42,7 @@
 
 #include <gmp.h>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "arbitrary_precision_calculation/random_number_generator.h"
@@ -248,6 +249,24 @@ int GetNumberOfMpftValuesInUse();
 */
 int GetNumberOfMpftValuesCached();
 /**
+* @brief Getter function for the number of mpf_t values for which memory is currently reserved.
+*
+* This includes the values in use and the released values which are kept for reuse.
+*
+* @return The number of reserved mpf_t values.
+*/
+int GetNumberOfMpftValuesReserved();
+/**
+* @brief Returns the memory of released mpf_t values to the operating system.
+*
+* Frees the limbs of all released values of the current thread and of finished threads.
+* Afterwards all memory blocks of mpf_t values which are completely unused are freed,
+* unless a ScopedMpftArena is alive in any thread.
+* Long running processes should call this function after phases with many values in use.
+* See also Configuration::setMaximalCachedReleasedMpftValues and Configuration::setMaximalCachedReleasedMpftLimbBytes.
+*/
+void TrimMpftPool();
+/**
 * @brief Changes the number of mpf_t values currently in cache by the specified number.
 *
 * If any class stores values for later usage then this needs to be announced here.
@@ -272,6 +291,9 @@ void StatisticalCalculationsStart();
 void StatisticalCalculationsEnd();
 /**
 * @brief Increases the precision instantly to a higher value.
+*
+* The new precision depends on the precision growth strategy of the configuration (see Configuration::setPrecisionGrowthStrategy).
+* The strategies which use the recommended precision increase the precision by at least one limb.
 */
 void IncreasePrecision();
 /**
@@ -281,6 +303,16 @@ void IncreasePrecision();
 */
 mpf_t* GetResultPointer();
 /**
+* @brief Prepares an mpf_t value with the specified precision for using it.
+*
+* This is meant for intermediate values which need guard bits beyond the current precision.
+*
+* @param precision The precision of the mpf_t in bits.
+*
+* @return The pointer to the prepared mpf_t.
+*/
+mpf_t* GetResultPointer(mp_bitcnt_t precision);
+/**
 * @brief Performs an addition of the two values.
 *
 * @param a The first value.
@@ -335,6 +367,147 @@ mpf_t* Multiply(const mpf_t* a, const double b);
 */
 mpf_t* Divide(const mpf_t* a, const mpf_t* b);
 /**
+* @brief Performs an addition of the two values and stores the result in the destination.
+*
+* The destination is reused if it is a regular value of the current precision.
+* Otherwise it is released and replaced by a new value.
+* The destination may be the same as one of the operands.
+* Functions which need temporary values for their calculation (like Exp) release the destination
+* and return their result instead.
+*
+* @param dst The destination. It is either NULL or a value which is not used anymore after this call.
+* @param a The first value.
+* @param b The second value.
+*
+* @return a + b. The returned pointer replaces the destination.
+*/
+mpf_t* Add(mpf_t* dst, const mpf_t* a, const mpf_t* b);
+/**
+* @brief Performs a subtraction of the two values and stores the result in the destination.
+*
+* @param dst The destination (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param a The first value.
+* @param b The second value.
+*
+* @return a - b. The returned pointer replaces the destination.
+*/
+mpf_t* Subtract(mpf_t* dst, const mpf_t* a, const mpf_t* b);
+/**
+* @brief Performs an addition of the two values without checking the precision.
+*
+* @param a The first value.
+* @param b The second value.
+*
+* @return a + b
+*/
+mpf_t* AddNoCheck(const mpf_t* a, const mpf_t* b);
+/**
+* @brief Performs an addition of the two values without checking the precision and stores the result in the destination.
+*
+* @param dst The destination (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param a The first value.
+* @param b The second value.
+*
+* @return a + b. The returned pointer replaces the destination.
+*/
+mpf_t* AddNoCheck(mpf_t* dst, const mpf_t* a, const mpf_t* b);
+/**
+* @brief Performs a subtraction of the two values without checking the precision.
+*
+* @param a The first value.
+* @param b The second value.
+*
+* @return a - b
+*/
+mpf_t* SubtractNoCheck(const mpf_t* a, const mpf_t* b);
+/**
+* @brief Performs a subtraction of the two values without checking the precision and stores the result in the destination.
+*
+* @param dst The destination (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param a The first value.
+* @param b The second value.
+*
+* @return a - b. The returned pointer replaces the destination.
+*/
+mpf_t* SubtractNoCheck(mpf_t* dst, const mpf_t* a, const mpf_t* b);
+/**
+* @brief Decides by the configuration whether the precision of the next addition should be checked.
+*
+* Considers the check precision mode, the check precision probability and whether statistical calculations are active.
+*
+* @return True if and only if the precision should be checked.
+*/
+bool IsPrecisionCheckDue();
+/**
+* @brief Recommends an increase of the precision if the addition (or subtraction) of the two values loses too many bits.
+*
+* The smallest precision for which the check would pass is recorded (see Configuration::getRecommendedPrecision).
+* Only the exponents and the leading limbs of the values are inspected, hence no value is allocated.
+* Infinite and undefined values are ignored.
+*
+* @param a The first value.
+* @param b The second value.
+* @param subtraction Specifies whether a - b instead of a + b is calculated.
+*/
+void CheckPrecisionOnAdd(const mpf_t* a, const mpf_t* b, bool subtraction);
+/**
+* @brief Multiplies the value of parameter a by a factor of 2<sup>p</sup> and stores the result in the destination.
+*
+* @param dst The destination (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param a The factor.
+* @param p The exponent.
+*
+* @return a &middot; 2<sup>p</sup>. The returned pointer replaces the destination.
+*/
+mpf_t* Multiply2Exp(mpf_t* dst, const mpf_t* a, int p);
+/**
+* @brief Performs a multiplication of the two values and stores the result in the destination.
+*
+* @param dst The destination (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param a The first value.
+* @param b The second value.
+*
+* @return a &middot; b. The returned pointer replaces the destination.
+*/
+mpf_t* Multiply(mpf_t* dst, const mpf_t* a, const mpf_t* b);
+/**
+* @brief Performs a division of the two values and stores the result in the destination.
+*
+* @param dst The destination (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param a The first value.
+* @param b The second value.
+*
+* @return a / b. The returned pointer replaces the destination.
+*/
+mpf_t* Divide(mpf_t* dst, const mpf_t* a, const mpf_t* b);
+/**
+* @brief Calculates the absolute value of the supplied value and stores the result in the destination.
+*
+* @param dst The destination (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param x The supplied value.
+*
+* @return abs( x ). The returned pointer replaces the destination.
+*/
+mpf_t* Abs(mpf_t* dst, const mpf_t* x);
+/**
+* @brief Calculates the negation of the supplied value and stores the result in the destination.
+*
+* @param dst The destination (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param x The supplied value.
+*
+* @return -x. The returned pointer replaces the destination.
+*/
+mpf_t* Negate(mpf_t* dst, const mpf_t* x);
+/**
+* @brief Stores the value of the source in the destination.
+*
+* @param dst The destination (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param value The source.
+*
+* @return The copy of the value. The returned pointer replaces the destination.
+*/
+mpf_t* Assign(mpf_t* dst, const mpf_t* value);
+/**
 * @brief Releases the reserved memory for the supplied mpf_t.
 *
 * The supplied mpf_t object will be reused soon.
@@ -355,6 +528,24 @@ mpf_t* GetPi();
 */
 mpf_t* GetE();
 /**
+* @brief Calculates the value of the natural logarithm of 2.
+*
+* @return ln(2).
+*/
+mpf_t* GetLn2();
+/**
+* @brief Calculates the value of the natural logarithm of 10.
+*
+* @return ln(10).
+*/
+mpf_t* GetLn10();
+/**
+* @brief Calculates the value of the square root of 2.
+*
+* @return sqrt(2).
+*/
+mpf_t* GetSqrt2();
+/**
 * @brief Calculates the exponential function of the input.
 *
 * @param a The input.
@@ -363,6 +554,15 @@ mpf_t* GetE();
 */
 mpf_t* Exp(mpf_t* a);
 /**
+* @brief Calculates the exponential function of the input and stores the result in the destination.
+*
+* @param dst The destination (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param a The input.
+*
+* @return exp( a ). The returned pointer replaces the destination.
+*/
+mpf_t* Exp(mpf_t* dst, mpf_t* a);
+/**
 * @brief Compares the two parameters.
 *
 * @param a The first parameter.
@@ -458,6 +658,15 @@ bool IsUndefined(const mpf_t* value);
 */
 mpf_t* Sin(mpf_t* x);
 /**
+* @brief Calculates the sine function of the supplied value and stores the result in the destination.
+*
+* @param dst The destination (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param x The supplied value.
+*
+* @return sin( x ). The returned pointer replaces the destination.
+*/
+mpf_t* Sin(mpf_t* dst, mpf_t* x);
+/**
 * @brief Calculates the cosine function of the supplied value.
 *
 * @param x The supplied value.
@@ -466,6 +675,36 @@ mpf_t* Sin(mpf_t* x);
 */
 mpf_t* Cos(mpf_t* x);
 /**
+* @brief Calculates the cosine function of the supplied value and stores the result in the destination.
+*
+* @param dst The destination (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param x The supplied value.
+*
+* @return cos( x ). The returned pointer replaces the destination.
+*/
+mpf_t* Cos(mpf_t* dst, mpf_t* x);
+/**
+* @brief Calculates the sine and the cosine function of the supplied value.
+*
+* Both values share one argument reduction and one series evaluation,
+* hence this is cheaper than separate calls of Sin and Cos.
+*
+* @param x The supplied value.
+*
+* @return The pair ( sin( x ), cos( x ) ). Both values have to be released.
+*/
+std::pair<mpf_t*, mpf_t*> SinCos(mpf_t* x);
+/**
+* @brief Calculates the sine and the cosine function of the supplied value and stores the results in the destinations.
+*
+* @param dst_sin The destination of the sine (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param dst_cos The destination of the cosine (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param x The supplied value.
+*
+* @return The pair ( sin( x ), cos( x ) ). The returned pointers replace the destinations.
+*/
+std::pair<mpf_t*, mpf_t*> SinCos(mpf_t* dst_sin, mpf_t* dst_cos, mpf_t* x);
+/**
 * @brief Calculates the tangent function of the supplied value.
 *
 * @param x The supplied value.
@@ -474,6 +713,15 @@ mpf_t* Cos(mpf_t* x);
 */
 mpf_t* Tan(mpf_t* x);
 /**
+* @brief Calculates the tangent function of the supplied value and stores the result in the destination.
+*
+* @param dst The destination (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param x The supplied value.
+*
+* @return tan( x ). The returned pointer replaces the destination.
+*/
+mpf_t* Tan(mpf_t* dst, mpf_t* x);
+/**
 * @brief Calculates the arcsine function of the supplied value.
 *
 * @param x The supplied value.
@@ -482,6 +730,15 @@ mpf_t* Tan(mpf_t* x);
 */
 mpf_t* Arcsin(mpf_t* x);
 /**
+* @brief Calculates the arcsine function of the supplied value and stores the result in the destination.
+*
+* @param dst The destination (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param x The supplied value.
+*
+* @return arcsin( x ). The returned pointer replaces the destination.
+*/
+mpf_t* Arcsin(mpf_t* dst, mpf_t* x);
+/**
 * @brief Calculates the arccosine function of the supplied value.
 *
 * @param x The supplied value.
@@ -490,6 +747,15 @@ mpf_t* Arcsin(mpf_t* x);
 */
 mpf_t* Arccos(mpf_t* x);
 /**
+* @brief Calculates the arccosine function of the supplied value and stores the result in the destination.
+*
+* @param dst The destination (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param x The supplied value.
+*
+* @return arccos( x ). The returned pointer replaces the destination.
+*/
+mpf_t* Arccos(mpf_t* dst, mpf_t* x);
+/**
 * @brief Calculates the arctangent function of the supplied value.
 *
 * @param x The supplied value.
@@ -498,6 +764,166 @@ mpf_t* Arccos(mpf_t* x);
 */
 mpf_t* Arctan(mpf_t* x);
 /**
+* @brief Calculates the arctangent function of the supplied value and stores the result in the destination.
+*
+* @param dst The destination (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param x The supplied value.
+*
+* @return arctan( x ). The returned pointer replaces the destination.
+*/
+mpf_t* Arctan(mpf_t* dst, mpf_t* x);
+/**
+* @brief Calculates the angle of the point ( x, y ), i.e. the two-argument arctangent.
+*
+* The quadrant is determined by the signs of both values, hence the result lies in (-pi, pi].
+* Infinite values are treated as the limit directions, atan2( 0, 0 ) is 0.
+*
+* @param y The y-coordinate of the point.
+* @param x The x-coordinate of the point.
+*
+* @return atan2( y, x )
+*/
+mpf_t* Atan2(mpf_t* y, mpf_t* x);
+/**
+* @brief Calculates the angle of the point ( x, y ) and stores the result in the destination.
+*
+* @param dst The destination (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param y The y-coordinate of the point.
+* @param x The x-coordinate of the point.
+*
+* @return atan2( y, x ). The returned pointer replaces the destination.
+*/
+mpf_t* Atan2(mpf_t* dst, mpf_t* y, mpf_t* x);
+/**
+* @brief Calculates the hyperbolic sine function of the supplied value.
+*
+* Small arguments use the series of sinh, which avoids the cancellation of ( exp( x ) - exp( -x ) ) / 2.
+*
+* @param x The supplied value.
+*
+* @return sinh( x )
+*/
+mpf_t* Sinh(mpf_t* x);
+/**
+* @brief Calculates the hyperbolic sine function of the supplied value and stores the result in the destination.
+*
+* @param dst The destination (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param x The supplied value.
+*
+* @return sinh( x ). The returned pointer replaces the destination.
+*/
+mpf_t* Sinh(mpf_t* dst, mpf_t* x);
+/**
+* @brief Calculates the hyperbolic cosine function of the supplied value.
+*
+* @param x The supplied value.
+*
+* @return cosh( x )
+*/
+mpf_t* Cosh(mpf_t* x);
+/**
+* @brief Calculates the hyperbolic cosine function of the supplied value and stores the result in the destination.
+*
+* @param dst The destination (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param x The supplied value.
+*
+* @return cosh( x ). The returned pointer replaces the destination.
+*/
+mpf_t* Cosh(mpf_t* dst, mpf_t* x);
+/**
+* @brief Calculates the hyperbolic sine and the hyperbolic cosine function of the supplied value.
+*
+* Both values share one evaluation of the exponential function (or of the series for small arguments),
+* hence this is cheaper than separate calls of Sinh and Cosh.
+*
+* @param x The supplied value.
+*
+* @return The pair ( sinh( x ), cosh( x ) ). Both values have to be released.
+*/
+std::pair<mpf_t*, mpf_t*> SinhCosh(mpf_t* x);
+/**
+* @brief Calculates the hyperbolic sine and the hyperbolic cosine function of the supplied value and stores the results in the destinations.
+*
+* @param dst_sinh The destination of the hyperbolic sine (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param dst_cosh The destination of the hyperbolic cosine (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param x The supplied value.
+*
+* @return The pair ( sinh( x ), cosh( x ) ). The returned pointers replace the destinations.
+*/
+std::pair<mpf_t*, mpf_t*> SinhCosh(mpf_t* dst_sinh, mpf_t* dst_cosh, mpf_t* x);
+/**
+* @brief Calculates the hyperbolic tangent function of the supplied value.
+*
+* @param x The supplied value.
+*
+* @return tanh( x )
+*/
+mpf_t* Tanh(mpf_t* x);
+/**
+* @brief Calculates the hyperbolic tangent function of the supplied value and stores the result in the destination.
+*
+* @param dst The destination (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param x The supplied value.
+*
+* @return tanh( x ). The returned pointer replaces the destination.
+*/
+mpf_t* Tanh(mpf_t* dst, mpf_t* x);
+/**
+* @brief Calculates the inverse hyperbolic sine function of the supplied value.
+*
+* @param x The supplied value.
+*
+* @return asinh( x )
+*/
+mpf_t* Asinh(mpf_t* x);
+/**
+* @brief Calculates the inverse hyperbolic sine function of the supplied value and stores the result in the destination.
+*
+* @param dst The destination (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param x The supplied value.
+*
+* @return asinh( x ). The returned pointer replaces the destination.
+*/
+mpf_t* Asinh(mpf_t* dst, mpf_t* x);
+/**
+* @brief Calculates the inverse hyperbolic cosine function of the supplied value.
+*
+* The result is undefined for values smaller than one.
+*
+* @param x The supplied value.
+*
+* @return acosh( x )
+*/
+mpf_t* Acosh(mpf_t* x);
+/**
+* @brief Calculates the inverse hyperbolic cosine function of the supplied value and stores the result in the destination.
+*
+* @param dst The destination (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param x The supplied value.
+*
+* @return acosh( x ). The returned pointer replaces the destination.
+*/
+mpf_t* Acosh(mpf_t* dst, mpf_t* x);
+/**
+* @brief Calculates the inverse hyperbolic tangent function of the supplied value.
+*
+* The result is undefined for values outside of [-1, 1] and infinite for -1 and 1.
+*
+* @param x The supplied value.
+*
+* @return atanh( x )
+*/
+mpf_t* Atanh(mpf_t* x);
+/**
+* @brief Calculates the inverse hyperbolic tangent function of the supplied value and stores the result in the destination.
+*
+* @param dst The destination (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param x The supplied value.
+*
+* @return atanh( x ). The returned pointer replaces the destination.
+*/
+mpf_t* Atanh(mpf_t* dst, mpf_t* x);
+/**
 * @brief Converts the supplied double value to its mpf_t representation.
 *
 * @param value The supplied value.
@@ -506,6 +932,15 @@ mpf_t* Arctan(mpf_t* x);
 */
 mpf_t* ToMpft(double value);
 /**
+* @brief Converts the supplied double value to its mpf_t representation and stores the result in the destination.
+*
+* @param dst The destination (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param value The supplied value.
+*
+* @return The mpf_t representation of the supplied value. The returned pointer replaces the destination.
+*/
+mpf_t* ToMpft(mpf_t* dst, double value);
+/**
 * @brief Converts the supplied long long value to its mpf_t representation.
 *
 * @param value The supplied value.
@@ -573,6 +1008,16 @@ mpf_t* Clone(const mpf_t* value);
 */
 mpf_t* Max(mpf_t* a, mpf_t* b);
 /**
+* @brief Calculates the maximum of the two values and stores the result in the destination.
+*
+* @param dst The destination (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param a The first value.
+* @param b The second value.
+*
+* @return max ( a , b ). The returned pointer replaces the destination.
+*/
+mpf_t* Max(mpf_t* dst, mpf_t* a, mpf_t* b);
+/**
 * @brief Calculates the minimum of the two values.
 *
 * @param a The first value.
@@ -582,6 +1027,16 @@ mpf_t* Max(mpf_t* a, mpf_t* b);
 */
 mpf_t* Min(mpf_t* a, mpf_t* b);
 /**
+* @brief Calculates the minimum of the two values and stores the result in the destination.
+*
+* @param dst The destination (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param a The first value.
+* @param b The second value.
+*
+* @return min ( a , b ). The returned pointer replaces the destination.
+*/
+mpf_t* Min(mpf_t* dst, mpf_t* a, mpf_t* b);
+/**
 * @brief Calculates the largest integral value less or equal than the supplied value.
 *
 * The supplied value will be rounded down to the next integral value.
@@ -592,6 +1047,17 @@ mpf_t* Min(mpf_t* a, mpf_t* b);
 */
 mpf_t* Floor(mpf_t* value);
 /**
+* @brief Calculates the largest integral value less or equal than the supplied value and stores the result in the destination.
+*
+* The supplied value will be rounded down to the next integral value.
+*
+* @param dst The destination (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param value The supplied value.
+*
+* @return The rounded value. The returned pointer replaces the destination.
+*/
+mpf_t* Floor(mpf_t* dst, mpf_t* value);
+/**
 * @brief Calculates the smallest integral value greater or equal than the supplied value.
 *
 * The supplied value will be rounded up to the next integral value.
@@ -602,6 +1068,17 @@ mpf_t* Floor(mpf_t* value);
 */
 mpf_t* Ceil(mpf_t* value);
 /**
+* @brief Calculates the smallest integral value greater or equal than the supplied value and stores the result in the destination.
+*
+* The supplied value will be rounded up to the next integral value.
+*
+* @param dst The destination (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param value The supplied value.
+*
+* @return The rounded value. The returned pointer replaces the destination.
+*/
+mpf_t* Ceil(mpf_t* dst, mpf_t* value);
+/**
 * @brief Calculates a random mpf_t value in the range [0,1] with the supplied random number generator.
 *
 * @param random The random number generator.
@@ -665,10 +1142,21 @@ double MpftToDouble(mpf_t* value);
 * @param value The value.
 * @param exponent The exponent.
 *
-* @return value to the power of exponent.
+* @return value to the power of exponent. For integral exponents the result is exact,
+* if value to the power of |exponent| and the result fit into the default precision.
 */
 mpf_t* Pow(mpf_t* value, int exponent);
 /**
+* @brief Calculates the value to the power of the specified exponent and stores the result in the destination.
+*
+* @param dst The destination (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param value The value.
+* @param exponent The exponent.
+*
+* @return value to the power of exponent. The returned pointer replaces the destination.
+*/
+mpf_t* Pow(mpf_t* dst, mpf_t* value, int exponent);
+/**
 * @brief Calculates the value to the power of the specified exponent.
 *
 * @param value The value.
@@ -678,15 +1166,36 @@ mpf_t* Pow(mpf_t* value, int exponent);
 */
 mpf_t* Pow(mpf_t* value, double exponent);
 /**
+* @brief Calculates the value to the power of the specified exponent and stores the result in the destination.
+*
+* @param dst The destination (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param value The value.
+* @param exponent The exponent.
+*
+* @return value to the power of exponent. The returned pointer replaces the destination.
+*/
+mpf_t* Pow(mpf_t* dst, mpf_t* value, double exponent);
+/**
 * @brief Calculates the value to the power of the specified exponent.
 *
 * @param value The value.
 * @param exponent The exponent.
 *
-* @return value to the power of exponent.
+* @return value to the power of exponent. For integral exponents the result is exact,
+* if value to the power of |exponent| and the result fit into the default precision.
 */
 mpf_t* Pow(mpf_t* value, mpf_t* exponent);
 /**
+* @brief Calculates the value to the power of the specified exponent and stores the result in the destination.
+*
+* @param dst The destination (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param value The value.
+* @param exponent The exponent.
+*
+* @return value to the power of exponent. The returned pointer replaces the destination.
+*/
+mpf_t* Pow(mpf_t* dst, mpf_t* value, mpf_t* exponent);
+/**
 * @brief Calculates the square root of the specified value.
 *
 * @param value The value
@@ -695,6 +1204,15 @@ mpf_t* Pow(mpf_t* value, mpf_t* exponent);
 */
 mpf_t* Sqrt(mpf_t* value);
 /**
+* @brief Calculates the square root of the specified value and stores the result in the destination.
+*
+* @param dst The destination (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param value The value
+*
+* @return The square root of the specified value. The returned pointer replaces the destination.
+*/
+mpf_t* Sqrt(mpf_t* dst, mpf_t* value);
+/**
 * @brief Calculates the base E logarithm of the specified value.
 *
 * @param value The value.
@@ -703,6 +1221,34 @@ mpf_t* Sqrt(mpf_t* value);
 */
 mpf_t* LogE(mpf_t* value);
 /**
+* @brief Calculates the base E logarithm of the specified value and stores the result in the destination.
+*
+* @param dst The destination (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* @param value The value.
+*
+* @return The base E logarithm of the specified value. The returned pointer replaces the destination.
+*/
+mpf_t* LogE(mpf_t* dst, mpf_t* value);
+/**
+* @brief Measures the algorithms for sine, cosine and the natural logarithm on this host and selects the faster one for each precision.
+*
+* For each precision of the grid the Taylor series and the CORDIC algorithm as well as the series and the arithmetic-geometric mean are timed.
+* The CORDIC minimal precision (AGM minimal precision) is set to the smallest precision of the grid
+* from which on the CORDIC algorithm (the arithmetic-geometric mean) was faster for all larger precisions of the grid,
+* and both algorithms are set to the automatic selection.
+* The selection can be kept for later runs by Configuration::StoreAlgorithmProfile.
+* The default precision is changed during the measurements and restored afterwards, hence no other thread may calculate meanwhile.
+*
+* @param precisions The precision grid in bits.
+*/
+void TuneAlgorithms(const std::vector<mp_bitcnt_t> & precisions);
+/**
+* @brief Measures the algorithms for sine, cosine and the natural logarithm on this host for the precisions from 256 to 16384 bits.
+*
+* See TuneAlgorithms(const std::vector<mp_bitcnt_t> &).
+*/
+void TuneAlgorithms();
+/**
 * @brief Calculates the base 2 logarithm of the specified value.
 *
 * @param value The value.
@@ -0,0 +1,242 @@
+/**
+* @file   arbitrary_precision_calculation/precision_check_policy.h
+* @author Alexander Raß (alexander.rass@fau.de)
+* @date   October, 2026
+* @brief  This file contains policies which select at compile time whether additions check the precision.
+*
+* @copyright
+* This project is released under the MIT License (MIT).
+*
+* @copyright
+* The MIT License (MIT)
+*
+* @copyright
+* Copyright (c) 2016 by Friedrich-Alexander-Universität Erlangen-Nürnberg and
+* Alexander Raß
+*
+* @copyright
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* @copyright
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* @copyright
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#ifndef ARBITRARY_PRECISION_CALCULATION_PRECISION_CHECK_POLICY_H_
+#define ARBITRARY_PRECISION_CALCULATION_PRECISION_CHECK_POLICY_H_
+
+#include <gmp.h>
+#include <vector>
+
+#include "arbitrary_precision_calculation/check_condition.h"
+#include "arbitrary_precision_calculation/configuration.h"
+#include "arbitrary_precision_calculation/operations.h"
+
+namespace arbitraryprecisioncalculation {
+
+/**
+* @brief Contains the policies for the template parameter of Add and Subtract.
+*
+* A policy supplies the static function ShouldCheck, which decides before each addition or subtraction
+* whether the loss of precision is checked (see mpftoperations::CheckPrecisionOnAdd).
+*/
+namespace precisioncheck {
+
+/**
+* @brief Checks the precision as configured (check precision mode and probability).
+*
+* This is the behavior of the operations without template parameter.
+*/
+struct Checked {
+	/**
+	* @brief Decides whether the next addition should be checked.
+	*
+	* @return True if and only if the precision should be checked.
+	*/
+	static inline bool ShouldCheck() {
+		return Configuration::getCheckPrecisionMode() != configuration::CHECK_PRECISION_NEVER
+				&& mpftoperations::IsPrecisionCheckDue();
+	}
+};
+
+/**
+* @brief Checks the precision of every Period-th addition of the current thread, independent of the configuration.
+*
+* @tparam Period The distance between two checked additions.
+*/
+template<unsigned int Period>
+struct Sampled {
+	static_assert(Period > 0, "The period of sampled precision checks has to be positive.");
+	/**
+	* @brief Decides whether the next addition should be checked.
+	*
+	* @return True if and only if the precision should be checked.
+	*/
+	static inline bool ShouldCheck() {
+		static thread_local unsigned int counter = 0;
+		if(++counter < Period) return false;
+		counter = 0;
+		return true;
+	}
+};
+
+/**
+* @brief Never checks the precision. The check is removed at compile time.
+*/
+struct Unchecked {
+	/**
+	* @brief Decides whether the next addition should be checked.
+	*
+	* @return Always false.
+	*/
+	static inline bool ShouldCheck() {
+		return false;
+	}
+};
+
+} // namespace precisioncheck
+
+namespace mpftoperations {
+
+/**
+* @brief Performs an addition of the two input values. The precision check is selected by the policy.
+*
+* @tparam Policy The precision check policy (see namespace precisioncheck).
+* @param a The first input value.
+* @param b The second input value.
+*
+* @return The sum of the two input values.
+*/
+template<class Policy>
+inline mpf_t* Add(const mpf_t* a, const mpf_t* b) {
+	if(Policy::ShouldCheck()) CheckPrecisionOnAdd(a, b, false);
+	return AddNoCheck(a, b);
+}
+
+/**
+* @brief Performs a subtraction of the two input values. The precision check is selected by the policy.
+*
+* @tparam Policy The precision check policy (see namespace precisioncheck).
+* @param a The first input value.
+* @param b The second input value.
+*
+* @return The difference of the two input values.
+*/
+template<class Policy>
+inline mpf_t* Subtract(const mpf_t* a, const mpf_t* b) {
+	if(Policy::ShouldCheck()) CheckPrecisionOnAdd(a, b, true);
+	return SubtractNoCheck(a, b);
+}
+
+/**
+* @brief Performs an addition of the two input values into dst (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* The precision check is selected by the policy.
+*
+* @tparam Policy The precision check policy (see namespace precisioncheck).
+* @param dst The destination. It is released if it can not take the result.
+* @param a The first input value.
+* @param b The second input value.
+*
+* @return The pointer to the sum, which replaces dst.
+*/
+template<class Policy>
+inline mpf_t* Add(mpf_t* dst, const mpf_t* a, const mpf_t* b) {
+	if(Policy::ShouldCheck()) CheckPrecisionOnAdd(a, b, false);
+	return AddNoCheck(dst, a, b);
+}
+
+/**
+* @brief Performs a subtraction of the two input values into dst (see Add(mpf_t*, const mpf_t*, const mpf_t*)).
+* The precision check is selected by the policy.
+*
+* @tparam Policy The precision check policy (see namespace precisioncheck).
+* @param dst The destination. It is released if it can not take the result.
+* @param a The first input value.
+* @param b The second input value.
+*
+* @return The pointer to the difference, which replaces dst.
+*/
+template<class Policy>
+inline mpf_t* Subtract(mpf_t* dst, const mpf_t* a, const mpf_t* b) {
+	if(Policy::ShouldCheck()) CheckPrecisionOnAdd(a, b, true);
+	return SubtractNoCheck(dst, a, b);
+}
+
+} // namespace mpftoperations
+
+namespace vectoroperations {
+
+/**
+* @brief Performs element wise addition of the two vectors. The precision check is selected by the policy.
+*
+* @tparam Policy The precision check policy (see namespace precisioncheck).
+* @param a The first vector.
+* @param b The second vector.
+*
+* @return The result vector of the element wise addition.
+*/
+template<class Policy>
+std::vector<mpf_t*> Add(const std::vector<mpf_t*> & a, const std::vector<mpf_t*> & b) {
+	AssertCondition(a.size() == b.size(), "Addition of vectors with different size has been executed.");
+	std::vector<mpf_t*> res(a.size(), (mpf_t*)NULL);
+	for (unsigned int i = 0; i < a.size(); i++) {
+		res[i] = mpftoperations::Add<Policy>(a[i], b[i]);
+	}
+	return res;
+}
+
+/**
+* @brief Performs element wise subtraction of the two vectors. The precision check is selected by the policy.
+*
+* @tparam Policy The precision check policy (see namespace precisioncheck).
+* @param a The first vector.
+* @param b The second vector.
+*
+* @return The result vector of the element wise subtraction.
+*/
+template<class Policy>
+std::vector<mpf_t*> Subtract(const std::vector<mpf_t*> & a, const std::vector<mpf_t*> & b) {
+	AssertCondition(a.size() == b.size(), "Subtraction of vectors with different size has been executed.");
+	std::vector<mpf_t*> res(a.size(), (mpf_t*)NULL);
+	for (unsigned int i = 0; i < a.size(); i++) {
+		res[i] = mpftoperations::Subtract<Policy>(a[i], b[i]);
+	}
+	return res;
+}
+
+/**
+* @brief Calculates the sum of the vector entries. The precision check is selected by the policy.
+*
+* @tparam Policy The precision check policy (see namespace precisioncheck).
+* @param a The input vector.
+*
+* @return The sum.
+*/
+template<class Policy>
+mpf_t* Add(const std::vector<mpf_t*> & a) {
+	mpf_t* res = mpftoperations::ToMpft(0.0);
+	for(unsigned int i = 0; i < a.size(); i++){
+		res = mpftoperations::Add<Policy>(res, a[i], res);
+	}
+	return res;
+}
+
+} // namespace vectoroperations
+} // namespace arbitraryprecisioncalculation
+
+#endif /* ARBITRARY_PRECISION_CALCULATION_PRECISION_CHECK_POLICY_H_ */
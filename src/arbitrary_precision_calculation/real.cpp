@@ -0,0 +1,292 @@
+/**
+* @file   arbitrary_precision_calculation/real.cpp
+* @author Alexander Raß (alexander.rass@fau.de)
+* @date   October, 2026
+* @brief  This file contains a value type which owns an mpf_t and releases it automatically.
+*
+* @copyright
+* This project is released under the MIT License (MIT).
+*
+* @copyright
+* The MIT License (MIT)
+*
+* @copyright
+* Copyright (c) 2016 by Friedrich-Alexander-Universität Erlangen-Nürnberg and
+* Alexander Raß
+*
+* @copyright
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* @copyright
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* @copyright
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "arbitrary_precision_calculation/real.h"
+
+#include <utility>
+
+#include "arbitrary_precision_calculation/operations.h"
+
+namespace arbitraryprecisioncalculation {
+
+Real::Real() : value_(mpftoperations::ToMpft(0.0)) {}
+
+Real::Real(double value) : value_(mpftoperations::ToMpft(value)) {}
+
+Real::Real(int value) : value_(mpftoperations::ToMpft(value)) {}
+
+Real::Real(mpf_t* value) : value_(value) {}
+
+Real::Real(const Real & other) : value_(mpftoperations::Clone(other.value_)) {}
+
+Real::Real(Real && other) noexcept : value_(other.value_) {
+	other.value_ = NULL;
+}
+
+Real::~Real() {
+	mpftoperations::ReleaseValue(value_);
+}
+
+Real & Real::operator=(const Real & other) {
+	if (this != &other) {
+		value_ = mpftoperations::Assign(value_, other.value_);
+	}
+	return *this;
+}
+
+Real & Real::operator=(Real && other) noexcept {
+	std::swap(value_, other.value_);
+	return *this;
+}
+
+mpf_t* Real::Get() const {
+	return value_;
+}
+
+mpf_t* Real::Release() {
+	mpf_t* res = value_;
+	value_ = NULL;
+	return res;
+}
+
+Real & Real::operator+=(const Real & other) {
+	value_ = mpftoperations::Add(value_, value_, other.value_);
+	return *this;
+}
+
+Real & Real::operator-=(const Real & other) {
+	value_ = mpftoperations::Subtract(value_, value_, other.value_);
+	return *this;
+}
+
+Real & Real::operator*=(const Real & other) {
+	value_ = mpftoperations::Multiply(value_, value_, other.value_);
+	return *this;
+}
+
+Real & Real::operator/=(const Real & other) {
+	value_ = mpftoperations::Divide(value_, value_, other.value_);
+	return *this;
+}
+
+Real & Real::Multiply2Exp(int p) {
+	value_ = mpftoperations::Multiply2Exp(value_, value_, p);
+	return *this;
+}
+
+double Real::ToDouble() const {
+	return mpftoperations::MpftToDouble(value_);
+}
+
+std::string Real::ToString() const {
+	return mpftoperations::MpftToString(value_);
+}
+
+Real operator+(const Real & a, const Real & b) {
+	return Real(mpftoperations::Add(a.Get(), b.Get()));
+}
+
+Real operator+(Real && a, const Real & b) {
+	a += b;
+	return std::move(a);
+}
+
+Real operator+(const Real & a, Real && b) {
+	b += a;
+	return std::move(b);
+}
+
+Real operator+(Real && a, Real && b) {
+	a += b;
+	return std::move(a);
+}
+
+Real operator-(const Real & a, const Real & b) {
+	return Real(mpftoperations::Subtract(a.Get(), b.Get()));
+}
+
+Real operator-(Real && a, const Real & b) {
+	a -= b;
+	return std::move(a);
+}
+
+Real operator-(const Real & a, Real && b) {
+	mpf_t* value = b.Release();
+	return Real(mpftoperations::Subtract(value, a.Get(), value));
+}
+
+Real operator-(Real && a, Real && b) {
+	a -= b;
+	return std::move(a);
+}
+
+Real operator*(const Real & a, const Real & b) {
+	return Real(mpftoperations::Multiply(a.Get(), b.Get()));
+}
+
+Real operator*(Real && a, const Real & b) {
+	a *= b;
+	return std::move(a);
+}
+
+Real operator*(const Real & a, Real && b) {
+	b *= a;
+	return std::move(b);
+}
+
+Real operator*(Real && a, Real && b) {
+	a *= b;
+	return std::move(a);
+}
+
+Real operator/(const Real & a, const Real & b) {
+	return Real(mpftoperations::Divide(a.Get(), b.Get()));
+}
+
+Real operator/(Real && a, const Real & b) {
+	a /= b;
+	return std::move(a);
+}
+
+Real operator/(const Real & a, Real && b) {
+	mpf_t* value = b.Release();
+	return Real(mpftoperations::Divide(value, a.Get(), value));
+}
+
+Real operator/(Real && a, Real && b) {
+	a /= b;
+	return std::move(a);
+}
+
+Real operator-(const Real & a) {
+	return Real(mpftoperations::Negate(a.Get()));
+}
+
+Real operator-(Real && a) {
+	mpf_t* value = a.Release();
+	return Real(mpftoperations::Negate(value, value));
+}
+
+bool operator<(const Real & a, const Real & b) {
+	return mpftoperations::Compare(a.Get(), b.Get()) < 0;
+}
+
+bool operator<(const Real & a, double b) {
+	return mpftoperations::Compare(a.Get(), b) < 0;
+}
+
+bool operator>(const Real & a, const Real & b) {
+	return mpftoperations::Compare(a.Get(), b.Get()) > 0;
+}
+
+bool operator>(const Real & a, double b) {
+	return mpftoperations::Compare(a.Get(), b) > 0;
+}
+
+bool operator<=(const Real & a, const Real & b) {
+	return mpftoperations::Compare(a.Get(), b.Get()) <= 0;
+}
+
+bool operator<=(const Real & a, double b) {
+	return mpftoperations::Compare(a.Get(), b) <= 0;
+}
+
+bool operator>=(const Real & a, const Real & b) {
+	return mpftoperations::Compare(a.Get(), b.Get()) >= 0;
+}
+
+bool operator>=(const Real & a, double b) {
+	return mpftoperations::Compare(a.Get(), b) >= 0;
+}
+
+bool operator==(const Real & a, const Real & b) {
+	return mpftoperations::Compare(a.Get(), b.Get()) == 0;
+}
+
+bool operator==(const Real & a, double b) {
+	return mpftoperations::Compare(a.Get(), b) == 0;
+}
+
+bool operator!=(const Real & a, const Real & b) {
+	return mpftoperations::Compare(a.Get(), b.Get()) != 0;
+}
+
+bool operator!=(const Real & a, double b) {
+	return mpftoperations::Compare(a.Get(), b) != 0;
+}
+
+Real Abs(const Real & a) {
+	return Real(mpftoperations::Abs(a.Get()));
+}
+
+Real Abs(Real && a) {
+	mpf_t* value = a.Release();
+	return Real(mpftoperations::Abs(value, value));
+}
+
+Real Sqrt(const Real & a) {
+	return Real(mpftoperations::Sqrt(a.Get()));
+}
+
+Real Exp(const Real & a) {
+	return Real(mpftoperations::Exp(a.Get()));
+}
+
+Real LogE(const Real & a) {
+	return Real(mpftoperations::LogE(a.Get()));
+}
+
+Real Sin(const Real & a) {
+	return Real(mpftoperations::Sin(a.Get()));
+}
+
+Real Cos(const Real & a) {
+	return Real(mpftoperations::Cos(a.Get()));
+}
+
+std::pair<Real, Real> SinCos(const Real & a) {
+	std::pair<mpf_t*, mpf_t*> values = mpftoperations::SinCos(a.Get());
+	return std::make_pair(Real(values.first), Real(values.second));
+}
+
+Real Pow(const Real & a, const Real & b) {
+	return Real(mpftoperations::Pow(a.Get(), b.Get()));
+}
+
+} // namespace arbitraryprecisioncalculation
@@ -0,0 +1,395 @@
+/**
+* @file   arbitrary_precision_calculation/real.h
+* @author Alexander Raß (alexander.rass@fau.de)
+* @date   October, 2026
+* @brief  This file contains a value type which owns an mpf_t and releases it automatically.
+*
+* @copyright
+* This project is released under the MIT License (MIT).
+*
+* @copyright
+* The MIT License (MIT)
+*
+* @copyright
+* Copyright (c) 2016 by Friedrich-Alexander-Universität Erlangen-Nürnberg and
+* Alexander Raß
+*
+* @copyright
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* @copyright
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* @copyright
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#ifndef ARBITRARY_PRECISION_CALCULATION_REAL_H_
+#define ARBITRARY_PRECISION_CALCULATION_REAL_H_
+
+#include <gmp.h>
+#include <string>
+#include <utility>
+
+namespace arbitraryprecisioncalculation {
+
+/**
+* @brief Owns an mpf_t (or one of the special values infinity and undefined) and releases it on destruction.
+*
+* All calculations use the operations of mpftoperations and hence have the same semantics.
+* If an operand is an expiring temporary then its mpf_t is reused for the result.
+* Therefore expressions like a * b + c only need a single mpf_t for the result.
+*/
+class Real{
+public:
+	/**
+	* @brief The constructor. The value is zero.
+	*/
+	Real();
+	/**
+	* @brief The constructor.
+	*
+	* @param value The value.
+	*/
+	Real(double value);
+	/**
+	* @brief The constructor.
+	*
+	* @param value The value.
+	*/
+	Real(int value);
+	/**
+	* @brief The constructor. Takes the ownership of the supplied mpf_t.
+	*
+	* @param value The mpf_t, which is released by this object.
+	*/
+	explicit Real(mpf_t* value);
+	/**
+	* @brief The copy constructor.
+	*
+	* @param other The copied value.
+	*/
+	Real(const Real & other);
+	/**
+	* @brief The move constructor. The moved value must not be used afterwards except for assignments.
+	*
+	* @param other The moved value.
+	*/
+	Real(Real && other) noexcept;
+	/**
+	* @brief The destructor. Releases the mpf_t.
+	*/
+	~Real();
+	/**
+	* @brief The copy assignment. Reuses the mpf_t of this object if possible.
+	*
+	* @param other The copied value.
+	*
+	* @return This object.
+	*/
+	Real & operator=(const Real & other);
+	/**
+	* @brief The move assignment.
+	*
+	* @param other The moved value.
+	*
+	* @return This object.
+	*/
+	Real & operator=(Real && other) noexcept;
+
+	/**
+	* @brief Getter function for the mpf_t. The ownership stays with this object.
+	*
+	* @return The mpf_t.
+	*/
+	mpf_t* Get() const;
+	/**
+	* @brief Gives up the ownership of the mpf_t.
+	*
+	* @return The mpf_t, which has to be released by the caller.
+	*/
+	mpf_t* Release();
+
+	/**
+	* @brief Adds the supplied value.
+	*
+	* @param other The summand.
+	*
+	* @return This object.
+	*/
+	Real & operator+=(const Real & other);
+	/**
+	* @brief Subtracts the supplied value.
+	*
+	* @param other The subtrahend.
+	*
+	* @return This object.
+	*/
+	Real & operator-=(const Real & other);
+	/**
+	* @brief Multiplies by the supplied value.
+	*
+	* @param other The factor.
+	*
+	* @return This object.
+	*/
+	Real & operator*=(const Real & other);
+	/**
+	* @brief Divides by the supplied value.
+	*
+	* @param other The divisor.
+	*
+	* @return This object.
+	*/
+	Real & operator/=(const Real & other);
+	/**
+	* @brief Multiplies by a factor of 2<sup>p</sup>.
+	*
+	* @param p The exponent.
+	*
+	* @return This object.
+	*/
+	Real & Multiply2Exp(int p);
+
+	/**
+	* @brief Converts the value to double.
+	*
+	* @return The value as double.
+	*/
+	double ToDouble() const;
+	/**
+	* @brief Converts the value to a string (compare mpftoperations::MpftToString).
+	*
+	* @return The value as string.
+	*/
+	std::string ToString() const;
+
+private:
+	/**
+	* @brief The owned mpf_t. It is NULL after the value was moved or released.
+	*/
+	mpf_t* value_;
+};
+
+/**
+* @brief Performs an addition. Expiring operands are reused for the result.
+*
+* @param a The first value.
+* @param b The second value.
+*
+* @return a + b
+*/
+Real operator+(const Real & a, const Real & b);
+/** @copydoc operator+(const Real &, const Real &) */
+Real operator+(Real && a, const Real & b);
+/** @copydoc operator+(const Real &, const Real &) */
+Real operator+(const Real & a, Real && b);
+/** @copydoc operator+(const Real &, const Real &) */
+Real operator+(Real && a, Real && b);
+/**
+* @brief Performs a subtraction. Expiring operands are reused for the result.
+*
+* @param a The first value.
+* @param b The second value.
+*
+* @return a - b
+*/
+Real operator-(const Real & a, const Real & b);
+/** @copydoc operator-(const Real &, const Real &) */
+Real operator-(Real && a, const Real & b);
+/** @copydoc operator-(const Real &, const Real &) */
+Real operator-(const Real & a, Real && b);
+/** @copydoc operator-(const Real &, const Real &) */
+Real operator-(Real && a, Real && b);
+/**
+* @brief Performs a multiplication. Expiring operands are reused for the result.
+*
+* @param a The first value.
+* @param b The second value.
+*
+* @return a &middot; b
+*/
+Real operator*(const Real & a, const Real & b);
+/** @copydoc operator*(const Real &, const Real &) */
+Real operator*(Real && a, const Real & b);
+/** @copydoc operator*(const Real &, const Real &) */
+Real operator*(const Real & a, Real && b);
+/** @copydoc operator*(const Real &, const Real &) */
+Real operator*(Real && a, Real && b);
+/**
+* @brief Performs a division. Expiring operands are reused for the result.
+*
+* @param a The first value.
+* @param b The second value.
+*
+* @return a / b
+*/
+Real operator/(const Real & a, const Real & b);
+/** @copydoc operator/(const Real &, const Real &) */
+Real operator/(Real && a, const Real & b);
+/** @copydoc operator/(const Real &, const Real &) */
+Real operator/(const Real & a, Real && b);
+/** @copydoc operator/(const Real &, const Real &) */
+Real operator/(Real && a, Real && b);
+/**
+* @brief Calculates the negation. An expiring operand is reused for the result.
+*
+* @param a The value.
+*
+* @return -a
+*/
+Real operator-(const Real & a);
+/** @copydoc operator-(const Real &) */
+Real operator-(Real && a);
+
+/**
+* @brief Compares the two values (compare mpftoperations::Compare).
+*
+* @param a The first value.
+* @param b The second value.
+*
+* @return true if a < b.
+*/
+bool operator<(const Real & a, const Real & b);
+/** @copydoc operator<(const Real &, const Real &) */
+bool operator<(const Real & a, double b);
+/**
+* @brief Compares the two values (compare mpftoperations::Compare).
+*
+* @param a The first value.
+* @param b The second value.
+*
+* @return true if a > b.
+*/
+bool operator>(const Real & a, const Real & b);
+/** @copydoc operator>(const Real &, const Real &) */
+bool operator>(const Real & a, double b);
+/**
+* @brief Compares the two values (compare mpftoperations::Compare).
+*
+* @param a The first value.
+* @param b The second value.
+*
+* @return true if a <= b.
+*/
+bool operator<=(const Real & a, const Real & b);
+/** @copydoc operator<=(const Real &, const Real &) */
+bool operator<=(const Real & a, double b);
+/**
+* @brief Compares the two values (compare mpftoperations::Compare).
+*
+* @param a The first value.
+* @param b The second value.
+*
+* @return true if a >= b.
+*/
+bool operator>=(const Real & a, const Real & b);
+/** @copydoc operator>=(const Real &, const Real &) */
+bool operator>=(const Real & a, double b);
+/**
+* @brief Compares the two values (compare mpftoperations::Compare).
+*
+* @param a The first value.
+* @param b The second value.
+*
+* @return true if a == b.
+*/
+bool operator==(const Real & a, const Real & b);
+/** @copydoc operator==(const Real &, const Real &) */
+bool operator==(const Real & a, double b);
+/**
+* @brief Compares the two values (compare mpftoperations::Compare).
+*
+* @param a The first value.
+* @param b The second value.
+*
+* @return true if a != b.
+*/
+bool operator!=(const Real & a, const Real & b);
+/** @copydoc operator!=(const Real &, const Real &) */
+bool operator!=(const Real & a, double b);
+
+/**
+* @brief Calculates the absolute value. An expiring operand is reused for the result.
+*
+* @param a The value.
+*
+* @return abs( a )
+*/
+Real Abs(const Real & a);
+/** @copydoc Abs(const Real &) */
+Real Abs(Real && a);
+/**
+* @brief Calculates the square root of the value.
+*
+* @param a The value.
+*
+* @return sqrt( a )
+*/
+Real Sqrt(const Real & a);
+/**
+* @brief Calculates the exponential function of the value.
+*
+* @param a The value.
+*
+* @return exp( a )
+*/
+Real Exp(const Real & a);
+/**
+* @brief Calculates the natural logarithm of the value.
+*
+* @param a The value.
+*
+* @return log( a )
+*/
+Real LogE(const Real & a);
+/**
+* @brief Calculates the sine of the value.
+*
+* @param a The value.
+*
+* @return sin( a )
+*/
+Real Sin(const Real & a);
+/**
+* @brief Calculates the cosine of the value.
+*
+* @param a The value.
+*
+* @return cos( a )
+*/
+Real Cos(const Real & a);
+/**
+* @brief Calculates the sine and the cosine of the value with one shared argument reduction.
+*
+* @param a The value.
+*
+* @return The pair ( sin( a ), cos( a ) ).
+*/
+std::pair<Real, Real> SinCos(const Real & a);
+/**
+* @brief Calculates the power of the two values.
+*
+* @param a The base.
+* @param b The exponent.
+*
+* @return a<sup>b</sup>
+*/
+Real Pow(const Real & a, const Real & b);
+
+} // namespace arbitraryprecisioncalculation
+
+#endif /* ARBITRARY_PRECISION_CALCULATION_REAL_H_ */
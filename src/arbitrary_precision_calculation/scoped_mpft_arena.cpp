@@ -0,0 +1,67 @@
+/**
+* @file   arbitrary_precision_calculation/scoped_mpft_arena.cpp
+* @author Alexander Raß (alexander.rass@fau.de)
+* @date   October, 2026
+* @brief  This file contains an arena which releases all mpf_t values acquired during its lifetime.
+*
+* @copyright
+* This project is released under the MIT License (MIT).
+*
+* @copyright
+* The MIT License (MIT)
+*
+* @copyright
+* Copyright (c) 2016 by Friedrich-Alexander-Universität Erlangen-Nürnberg and
+* Alexander Raß
+*
+* @copyright
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* @copyright
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* @copyright
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "arbitrary_precision_calculation/scoped_mpft_arena.h"
+
+#include "arbitrary_precision_calculation/mpft_pool.h"
+#include "arbitrary_precision_calculation/operations.h"
+
+namespace arbitraryprecisioncalculation {
+
+ScopedMpftArena::ScopedMpftArena() : watermark_(MpftPool::OpenArena()) {}
+
+ScopedMpftArena::~ScopedMpftArena() {
+	MpftPool::CloseArena(watermark_);
+}
+
+mpf_t* ScopedMpftArena::Promote(mpf_t* value) {
+	if (value != NULL && !mpftoperations::IsInfinite(value) && !mpftoperations::IsUndefined(value)) {
+		MpftPool::PromoteValue(value);
+	}
+	return value;
+}
+
+const std::vector<mpf_t*> & ScopedMpftArena::Promote(const std::vector<mpf_t*> & values) {
+	for (unsigned int i = 0; i < values.size(); i++) {
+		Promote(values[i]);
+	}
+	return values;
+}
+
+} // namespace arbitraryprecisioncalculation
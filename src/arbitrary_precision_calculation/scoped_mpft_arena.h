@@ -0,0 +1,99 @@
+/**
+* @file   arbitrary_precision_calculation/scoped_mpft_arena.h
+* @author Alexander Raß (alexander.rass@fau.de)
+* @date   October, 2026
+* @brief  This file contains an arena which releases all mpf_t values acquired during its lifetime.
+*
+* @copyright
+* This project is released under the MIT License (MIT).
+*
+* @copyright
+* The MIT License (MIT)
+*
+* @copyright
+* Copyright (c) 2016 by Friedrich-Alexander-Universität Erlangen-Nürnberg and
+* Alexander Raß
+*
+* @copyright
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* @copyright
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* @copyright
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#ifndef ARBITRARY_PRECISION_CALCULATION_SCOPED_MPFT_ARENA_H_
+#define ARBITRARY_PRECISION_CALCULATION_SCOPED_MPFT_ARENA_H_
+
+#include <cstddef>
+#include <gmp.h>
+#include <vector>
+
+namespace arbitraryprecisioncalculation {
+
+/**
+* @brief Owns all mpf_t values which are acquired by the current thread during the lifetime of the arena.
+*
+* When the arena is destroyed all owned values are released at once.
+* Values which were already released by ReleaseValue are skipped.
+* Values which have to outlive the arena (like the result of a function) have to be promoted.
+* Promoted values are owned by the enclosing arena if one exists.
+*
+* Arenas have to be destroyed in reverse order of construction by the thread which constructed them.
+* Values owned by an arena must not be released by other threads.
+*/
+class ScopedMpftArena{
+public:
+	/**
+	* @brief The constructor. Records the watermark of the arena.
+	*/
+	ScopedMpftArena();
+	/**
+	* @brief The destructor. Releases all values owned by the arena.
+	*/
+	~ScopedMpftArena();
+	/**
+	* @brief Excludes the value from the release at the end of the arena.
+	*
+	* @param value The value.
+	*
+	* @return The supplied value.
+	*/
+	mpf_t* Promote(mpf_t* value);
+	/**
+	* @brief Excludes all values of the vector from the release at the end of the arena.
+	*
+	* @param values The values.
+	*
+	* @return The supplied values.
+	*/
+	const std::vector<mpf_t*> & Promote(const std::vector<mpf_t*> & values);
+
+private:
+	ScopedMpftArena(const ScopedMpftArena &) = delete;
+	ScopedMpftArena & operator=(const ScopedMpftArena &) = delete;
+
+	/**
+	* @brief The watermark of the arena.
+	*/
+	size_t watermark_;
+};
+
+} // namespace arbitraryprecisioncalculation
+
+#endif /* ARBITRARY_PRECISION_CALCULATION_SCOPED_MPFT_ARENA_H_ */
@@ -0,0 +1,736 @@
+/**
+* @file   testing/arbitrary_precision_calculation_benchmarks.cpp
+* @author Alexander Raß (alexander.rass@fau.de)
+* @date   October, 2026
+* @brief  This file contains benchmarks for the arbitrary precision calculations.
+*
+* @copyright
+* This project is released under the MIT License (MIT).
+*
+* @copyright
+* The MIT License (MIT)
+*
+* @copyright
+* Copyright (c) 2016 by Friedrich-Alexander-Universität Erlangen-Nürnberg and
+* Alexander Raß
+*
+* @copyright
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* @copyright
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* @copyright
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <gmp.h>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "arbitrary_precision_calculation/arbitraryprecisioncalculation.h"
+
+namespace arbitraryprecisioncalculation {
+
+const int OPERATIONS_PER_MEASUREMENT = 200000;
+const std::vector<unsigned int> BENCHMARK_PRECISIONS = {64, 256, 1024, 4096, 16384};
+
+// counts all memory requests of gmp
+std::atomic<unsigned long long> gmp_allocations(0);
+
+void* countingAllocate(size_t size){
+	++gmp_allocations;
+	return malloc(size);
+}
+
+void* countingReallocate(void* ptr, size_t old_size, size_t new_size){
+	++gmp_allocations;
+	return realloc(ptr, new_size);
+}
+
+void countingFree(void* ptr, size_t size){
+	free(ptr);
+}
+
+double secondsSince(const std::chrono::steady_clock::time_point & start){
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void printMeasurement(const std::string & name, unsigned int precision, unsigned long long allocations, double seconds, int operations){
+	std::cout << std::left << std::setw(28) << name
+		<< " precision=" << std::setw(6) << precision
+		<< " allocations/op=" << std::setw(10) << allocations / (double) operations
+		<< " ns/op=" << seconds * 1e9 / operations << std::endl;
+}
+
+// Compares the library operations with a plain usage of mpf_init and mpf_clear for each temporary.
+void benchmarkAllocations(){
+	std::cout << "benchmark allocations per operation\n";
+	for(unsigned int precision : BENCHMARK_PRECISIONS){
+		mpf_set_default_prec(precision);
+		mpf_t* a = mpftoperations::GetPi();
+		mpf_t* b = mpftoperations::GetE();
+		{
+			gmp_allocations = 0;
+			auto start = std::chrono::steady_clock::now();
+			for(int i = 0; i < OPERATIONS_PER_MEASUREMENT; i++){
+				mpf_t tmp;
+				mpf_init(tmp);
+				mpf_add(tmp, *a, *b);
+				mpf_clear(tmp);
+			}
+			printMeasurement("mpf_init + mpf_add", precision, gmp_allocations, secondsSince(start), OPERATIONS_PER_MEASUREMENT);
+		}
+		{
+			gmp_allocations = 0;
+			auto start = std::chrono::steady_clock::now();
+			for(int i = 0; i < OPERATIONS_PER_MEASUREMENT; i++){
+				mpftoperations::ReleaseValue(mpftoperations::Add(a, b));
+			}
+			printMeasurement("mpftoperations::Add", precision, gmp_allocations, secondsSince(start), OPERATIONS_PER_MEASUREMENT);
+		}
+		{
+			gmp_allocations = 0;
+			auto start = std::chrono::steady_clock::now();
+			for(int i = 0; i < OPERATIONS_PER_MEASUREMENT; i++){
+				mpf_t tmp;
+				mpf_init(tmp);
+				mpf_mul(tmp, *a, *b);
+				mpf_clear(tmp);
+			}
+			printMeasurement("mpf_init + mpf_mul", precision, gmp_allocations, secondsSince(start), OPERATIONS_PER_MEASUREMENT);
+		}
+		{
+			gmp_allocations = 0;
+			auto start = std::chrono::steady_clock::now();
+			for(int i = 0; i < OPERATIONS_PER_MEASUREMENT; i++){
+				mpftoperations::ReleaseValue(mpftoperations::Multiply(a, b));
+			}
+			printMeasurement("mpftoperations::Multiply", precision, gmp_allocations, secondsSince(start), OPERATIONS_PER_MEASUREMENT);
+		}
+		mpftoperations::ReleaseValue(a);
+		mpftoperations::ReleaseValue(b);
+	}
+}
+
+// Measures a request and release of an mpf_t without any calculation.
+void benchmarkPool(){
+	std::cout << "benchmark mpf_t pool\n";
+	for(unsigned int precision : BENCHMARK_PRECISIONS){
+		mpf_set_default_prec(precision);
+		gmp_allocations = 0;
+		auto start = std::chrono::steady_clock::now();
+		for(int i = 0; i < OPERATIONS_PER_MEASUREMENT; i++){
+			mpftoperations::ReleaseValue(mpftoperations::GetResultPointer());
+		}
+		printMeasurement("GetResultPointer+Release", precision, gmp_allocations, secondsSince(start), OPERATIONS_PER_MEASUREMENT);
+	}
+}
+
+// Measures the throughput of the operations while several threads calculate concurrently.
+void benchmarkThreads(){
+	std::cout << "benchmark concurrent threads\n";
+	const unsigned int precision = 256;
+	mpf_set_default_prec(precision);
+	for(int number_of_threads : {1, 2, 4, 8}){
+		gmp_allocations = 0;
+		auto start = std::chrono::steady_clock::now();
+		std::vector<std::thread> threads;
+		for(int t = 0; t < number_of_threads; t++){
+			threads.push_back(std::thread([](){
+				mpf_t* a = mpftoperations::GetPi();
+				mpf_t* b = mpftoperations::GetE();
+				for(int i = 0; i < OPERATIONS_PER_MEASUREMENT; i++){
+					mpf_t* sum = mpftoperations::Add(a, b);
+					mpftoperations::ReleaseValue(mpftoperations::Multiply(sum, a));
+					mpftoperations::ReleaseValue(sum);
+				}
+				mpftoperations::ReleaseValue(a);
+				mpftoperations::ReleaseValue(b);
+			}));
+		}
+		for(unsigned int t = 0; t < threads.size(); t++){
+			threads[t].join();
+		}
+		printMeasurement("Add+Multiply threads=" + std::to_string(number_of_threads), precision, gmp_allocations, secondsSince(start), number_of_threads * OPERATIONS_PER_MEASUREMENT);
+	}
+}
+
+// Compares the evaluation of a polynomial with Horner's method written against
+// the mpf_t* operations and written against Real.
+void benchmarkReal(){
+	std::cout << "benchmark polynomial evaluation\n";
+	const int degree = 16;
+	for(unsigned int precision : BENCHMARK_PRECISIONS){
+		mpf_set_default_prec(precision);
+		const int evaluations = OPERATIONS_PER_MEASUREMENT / degree;
+		mpf_t* x = mpftoperations::GetE();
+		{
+			gmp_allocations = 0;
+			auto start = std::chrono::steady_clock::now();
+			for(int i = 0; i < evaluations; i++){
+				mpf_t* res = mpftoperations::ToMpft(1.0);
+				for(int k = 1; k <= degree; k++){
+					mpf_t* tmp = mpftoperations::Multiply(res, x);
+					std::swap(tmp, res);
+					mpftoperations::ReleaseValue(tmp);
+					mpf_t* coefficient = mpftoperations::ToMpft(k);
+					tmp = mpftoperations::Add(res, coefficient);
+					std::swap(tmp, res);
+					mpftoperations::ReleaseValue(tmp);
+					mpftoperations::ReleaseValue(coefficient);
+				}
+				mpftoperations::ReleaseValue(res);
+			}
+			printMeasurement("Horner with mpf_t*", precision, gmp_allocations, secondsSince(start), evaluations * degree);
+		}
+		{
+			Real real_x(mpftoperations::Clone(x));
+			gmp_allocations = 0;
+			auto start = std::chrono::steady_clock::now();
+			for(int i = 0; i < evaluations; i++){
+				Real res(1.0);
+				for(int k = 1; k <= degree; k++){
+					res = std::move(res) * real_x + k;
+				}
+			}
+			printMeasurement("Horner with Real", precision, gmp_allocations, secondsSince(start), evaluations * degree);
+		}
+		mpftoperations::ReleaseValue(x);
+	}
+}
+
+// Measures the overhead of the precision check of Add and Subtract for the different check modes and policies.
+void benchmarkPrecisionCheck(){
+	std::cout << "benchmark precision check of Subtract\n";
+	const std::vector<std::pair<std::string, double> > modes = {{"Subtract check never", -1.0}, {"Subtract check always", 1.0}, {"Subtract check sampled 0.1", 0.1}};
+	for(unsigned int precision : BENCHMARK_PRECISIONS){
+		mpf_set_default_prec(precision);
+		mpf_t* a = mpftoperations::GetPi();
+		mpf_t* b = mpftoperations::GetE();
+		mpf_t* res = mpftoperations::ToMpft(0.0);
+		for(const std::pair<std::string, double> & mode : modes){
+			if(mode.second < 0){
+				Configuration::setCheckPrecisionMode(configuration::CHECK_PRECISION_NEVER);
+			} else {
+				Configuration::setCheckPrecisionMode(configuration::CHECK_PRECISION_ALWAYS);
+				Configuration::setCheckPrecisionProbability(mode.second);
+			}
+			gmp_allocations = 0;
+			auto start = std::chrono::steady_clock::now();
+			for(int i = 0; i < OPERATIONS_PER_MEASUREMENT; i++){
+				res = mpftoperations::Subtract(res, a, b);
+				Configuration::ResetIncreasePrecisionRecommended();
+			}
+			printMeasurement(mode.first, precision, gmp_allocations, secondsSince(start), OPERATIONS_PER_MEASUREMENT);
+		}
+		Configuration::setCheckPrecisionMode(configuration::CHECK_PRECISION_ALWAYS);
+		Configuration::setCheckPrecisionProbability(1.0);
+		{
+			gmp_allocations = 0;
+			auto start = std::chrono::steady_clock::now();
+			for(int i = 0; i < OPERATIONS_PER_MEASUREMENT; i++){
+				res = mpftoperations::Subtract<precisioncheck::Sampled<16> >(res, a, b);
+				Configuration::ResetIncreasePrecisionRecommended();
+			}
+			printMeasurement("Subtract<Sampled<16> >", precision, gmp_allocations, secondsSince(start), OPERATIONS_PER_MEASUREMENT);
+		}
+		{
+			gmp_allocations = 0;
+			auto start = std::chrono::steady_clock::now();
+			for(int i = 0; i < OPERATIONS_PER_MEASUREMENT; i++){
+				res = mpftoperations::Subtract<precisioncheck::Unchecked>(res, a, b);
+				Configuration::ResetIncreasePrecisionRecommended();
+			}
+			printMeasurement("Subtract<Unchecked>", precision, gmp_allocations, secondsSince(start), OPERATIONS_PER_MEASUREMENT);
+		}
+		mpftoperations::ReleaseValue(a);
+		mpftoperations::ReleaseValue(b);
+		mpftoperations::ReleaseValue(res);
+	}
+	Configuration::setCheckPrecisionMode(configuration::CHECK_PRECISION_NEVER);
+	Configuration::setCheckPrecisionProbability(1.0);
+}
+
+// Measures the calculation of constants for growing precisions, where the incremental variants
+// only evaluate the additional terms of their series.
+void benchmarkIncrementalConstants(){
+	std::cout << "benchmark incremental constants\n";
+	std::vector<unsigned int> precisions;
+	for(double precision = 4096; precision <= 262144; precision *= 1.25){
+		precisions.push_back((unsigned int)precision);
+	}
+	const std::vector<std::pair<std::string, mpf_t* (*)(mp_bitcnt_t)> > calculations = {
+		{"e", constantcalculation::CalculateE},
+		{"e incrementally", constantcalculation::CalculateEIncrementally},
+		{"ln(2)", constantcalculation::CalculateLn2},
+		{"ln(2) incrementally", constantcalculation::CalculateLn2Incrementally},
+	};
+	for(unsigned int c = 0; c < calculations.size(); c++){
+		gmp_allocations = 0;
+		auto start = std::chrono::steady_clock::now();
+		for(unsigned int precision : precisions){
+			mpftoperations::ReleaseValue(calculations[c].second(precision));
+		}
+		printMeasurement(calculations[c].first, precisions.back(), gmp_allocations, secondsSince(start), 1);
+	}
+	for(bool incrementally : {false, true}){
+		gmp_allocations = 0;
+		auto start = std::chrono::steady_clock::now();
+		for(unsigned int precision : precisions){
+			if(incrementally){
+				mpftoperations::ReleaseValue(constantcalculation::CalculatePiChudnovskyIncrementally(1, precision));
+			} else {
+				mpftoperations::ReleaseValue(constantcalculation::CalculatePiChudnovsky(1, precision));
+			}
+		}
+		printMeasurement(incrementally ? "pi incrementally" : "pi", precisions.back(), gmp_allocations, secondsSince(start), 1);
+	}
+}
+
+// Compares the calculation of pi by the Chudnovsky series with the Bailey-Borwein-Plouffe formula.
+void benchmarkPi(){
+	std::cout << "benchmark pi\n";
+	const std::vector<unsigned int> precisions = {1024, 4096, 16384, 65536, 262144, 1048576};
+	for(unsigned int precision : precisions){
+		mpf_set_default_prec(precision);
+		if(precision <= 16384){
+			gmp_allocations = 0;
+			auto start = std::chrono::steady_clock::now();
+			mpftoperations::ReleaseValue(constantcalculation::CalculatePiBaileyBorweinPlouffe());
+			printMeasurement("Pi Bailey-Borwein-Plouffe", precision, gmp_allocations, secondsSince(start), 1);
+		}
+		{
+			gmp_allocations = 0;
+			auto start = std::chrono::steady_clock::now();
+			mpftoperations::ReleaseValue(constantcalculation::CalculatePiChudnovsky(1));
+			printMeasurement("Pi Chudnovsky", precision, gmp_allocations, secondsSince(start), 1);
+		}
+		{
+			unsigned int threads = std::max(2u, std::thread::hardware_concurrency());
+			gmp_allocations = 0;
+			auto start = std::chrono::steady_clock::now();
+			mpftoperations::ReleaseValue(constantcalculation::CalculatePiChudnovsky(threads));
+			printMeasurement("Pi Chudnovsky threads=" + std::to_string(threads), precision, gmp_allocations, secondsSince(start), 1);
+		}
+	}
+}
+
+// Measures Exp for small and large arguments up to high precisions.
+void benchmarkExp(){
+	std::cout << "benchmark exp\n";
+	const std::vector<unsigned int> precisions = {1024, 4096, 16384, 65536, 131072};
+	const std::vector<double> arguments = {0.7, -100.3};
+	for(unsigned int precision : precisions){
+		mpf_set_default_prec(precision);
+		// the calculation of the cached constants is not measured
+		mpftoperations::ReleaseValue(mpftoperations::GetLn2());
+		const int evaluations = std::max(1, OPERATIONS_PER_MEASUREMENT / (int)precision / 20);
+		for(double argument : arguments){
+			mpf_t* x = mpftoperations::ToMpft(argument);
+			gmp_allocations = 0;
+			auto start = std::chrono::steady_clock::now();
+			for(int i = 0; i < evaluations; i++){
+				mpftoperations::ReleaseValue(mpftoperations::Exp(x));
+			}
+			printMeasurement("Exp(" + std::to_string(argument) + ")", precision, gmp_allocations, secondsSince(start), evaluations);
+			mpftoperations::ReleaseValue(x);
+		}
+	}
+}
+
+// Measures LogE for arguments close to 1 and large arguments up to high precisions.
+void benchmarkLog(){
+	std::cout << "benchmark log\n";
+	const std::vector<unsigned int> precisions = {1024, 4096, 16384, 32768, 65536, 131072};
+	const std::vector<double> arguments = {0.7, 1e300};
+	for(unsigned int precision : precisions){
+		mpf_set_default_prec(precision);
+		// the calculation of the cached constants is not measured
+		for(double argument : arguments){
+			mpf_t* x = mpftoperations::ToMpft(argument);
+			mpftoperations::ReleaseValue(mpftoperations::LogE(x));
+			mpftoperations::ReleaseValue(x);
+		}
+		const int evaluations = std::max(1, OPERATIONS_PER_MEASUREMENT / (int)precision / 20);
+		for(double argument : arguments){
+			mpf_t* x = mpftoperations::ToMpft(argument);
+			gmp_allocations = 0;
+			auto start = std::chrono::steady_clock::now();
+			for(int i = 0; i < evaluations; i++){
+				mpftoperations::ReleaseValue(mpftoperations::LogE(x));
+			}
+			std::ostringstream name;
+			name << "LogE(" << argument << ")";
+			printMeasurement(name.str(), precision, gmp_allocations, secondsSince(start), evaluations);
+			mpftoperations::ReleaseValue(x);
+		}
+	}
+}
+
+// Compares SinCos with separate calls of Sin and Cos.
+void benchmarkSinCos(){
+	std::cout << "benchmark sincos\n";
+	for(unsigned int precision : BENCHMARK_PRECISIONS){
+		mpf_set_default_prec(precision);
+		const int evaluations = std::max(1, OPERATIONS_PER_MEASUREMENT / (int)precision / 20);
+		mpf_t* x = mpftoperations::ToMpft(2.7);
+		{
+			gmp_allocations = 0;
+			auto start = std::chrono::steady_clock::now();
+			for(int i = 0; i < evaluations; i++){
+				mpftoperations::ReleaseValue(mpftoperations::Sin(x));
+				mpftoperations::ReleaseValue(mpftoperations::Cos(x));
+			}
+			printMeasurement("Sin+Cos", precision, gmp_allocations, secondsSince(start), evaluations);
+		}
+		{
+			gmp_allocations = 0;
+			auto start = std::chrono::steady_clock::now();
+			for(int i = 0; i < evaluations; i++){
+				std::pair<mpf_t*, mpf_t*> sin_cos = mpftoperations::SinCos(x);
+				mpftoperations::ReleaseValue(sin_cos.first);
+				mpftoperations::ReleaseValue(sin_cos.second);
+			}
+			printMeasurement("SinCos", precision, gmp_allocations, secondsSince(start), evaluations);
+		}
+		mpftoperations::ReleaseValue(x);
+	}
+}
+
+// Compares the algorithms for sine and cosine as well as for the logarithm and measures the tuner which selects between them.
+void benchmarkAlgorithms(){
+	std::cout << "benchmark algorithms\n";
+	const std::vector<unsigned int> precisions = {256, 1024, 4096, 16384};
+	const std::vector<std::pair<configuration::TrigonometricAlgorithm, std::string> > trigonometric_algorithms = {
+		{configuration::TRIGONOMETRIC_ALGORITHM_TAYLOR, "SinCos Taylor"},
+		{configuration::TRIGONOMETRIC_ALGORITHM_CORDIC, "SinCos CORDIC"}};
+	const std::vector<std::pair<configuration::LogarithmAlgorithm, std::string> > logarithm_algorithms = {
+		{configuration::LOGARITHM_ALGORITHM_SERIES, "LogE series"},
+		{configuration::LOGARITHM_ALGORITHM_AGM, "LogE AGM"}};
+	for(unsigned int precision : precisions){
+		mpf_set_default_prec(precision);
+		const int evaluations = std::max(1, OPERATIONS_PER_MEASUREMENT / (int)precision / 20);
+		mpf_t* angle = mpftoperations::ToMpft(0.7);
+		for(const std::pair<configuration::TrigonometricAlgorithm, std::string> & algorithm : trigonometric_algorithms){
+			Configuration::setTrigonometricAlgorithm(algorithm.first);
+			// the calculation of the cached values is not measured
+			std::pair<mpf_t*, mpf_t*> sin_cos = mpftoperations::SinCos(angle);
+			mpftoperations::ReleaseValue(sin_cos.first);
+			mpftoperations::ReleaseValue(sin_cos.second);
+			gmp_allocations = 0;
+			auto start = std::chrono::steady_clock::now();
+			for(int i = 0; i < evaluations; i++){
+				sin_cos = mpftoperations::SinCos(angle);
+				mpftoperations::ReleaseValue(sin_cos.first);
+				mpftoperations::ReleaseValue(sin_cos.second);
+			}
+			printMeasurement(algorithm.second, precision, gmp_allocations, secondsSince(start), evaluations);
+		}
+		mpftoperations::ReleaseValue(angle);
+		mpf_t* x = mpftoperations::ToMpft(2.7);
+		for(const std::pair<configuration::LogarithmAlgorithm, std::string> & algorithm : logarithm_algorithms){
+			Configuration::setLogarithmAlgorithm(algorithm.first);
+			mpftoperations::ReleaseValue(mpftoperations::LogE(x));
+			gmp_allocations = 0;
+			auto start = std::chrono::steady_clock::now();
+			for(int i = 0; i < evaluations; i++){
+				mpftoperations::ReleaseValue(mpftoperations::LogE(x));
+			}
+			printMeasurement(algorithm.second, precision, gmp_allocations, secondsSince(start), evaluations);
+		}
+		mpftoperations::ReleaseValue(x);
+	}
+	auto start = std::chrono::steady_clock::now();
+	mpftoperations::TuneAlgorithms();
+	std::cout << "TuneAlgorithms seconds=" << secondsSince(start)
+		<< " cordic minimal precision=" << Configuration::getCordicMinimalPrecision()
+		<< " log agm minimal precision=" << Configuration::getLogAgmMinimalPrecision() << std::endl;
+}
+
+// Compares SinhCosh and Tanh with their calculation by two calls of Exp.
+void benchmarkHyperbolic(){
+	std::cout << "benchmark hyperbolic\n";
+	for(unsigned int precision : BENCHMARK_PRECISIONS){
+		mpf_set_default_prec(precision);
+		const int evaluations = std::max(1, OPERATIONS_PER_MEASUREMENT / (int)precision / 20);
+		mpf_t* x = mpftoperations::ToMpft(0.7);
+		mpf_t* minus_x = mpftoperations::Negate(x);
+		{
+			gmp_allocations = 0;
+			auto start = std::chrono::steady_clock::now();
+			for(int i = 0; i < evaluations; i++){
+				mpf_t* exp_x = mpftoperations::Exp(x);
+				mpf_t* exp_minus_x = mpftoperations::Exp(minus_x);
+				mpf_t* difference = mpftoperations::Subtract(exp_x, exp_minus_x);
+				mpf_t* sum = mpftoperations::Add(exp_x, exp_minus_x);
+				mpftoperations::ReleaseValue(mpftoperations::Divide(difference, sum));
+				mpftoperations::ReleaseValue(exp_x);
+				mpftoperations::ReleaseValue(exp_minus_x);
+				mpftoperations::ReleaseValue(difference);
+				mpftoperations::ReleaseValue(sum);
+			}
+			printMeasurement("Exp+Exp tanh", precision, gmp_allocations, secondsSince(start), evaluations);
+		}
+		{
+			gmp_allocations = 0;
+			auto start = std::chrono::steady_clock::now();
+			for(int i = 0; i < evaluations; i++){
+				mpftoperations::ReleaseValue(mpftoperations::Tanh(x));
+			}
+			printMeasurement("Tanh", precision, gmp_allocations, secondsSince(start), evaluations);
+		}
+		{
+			gmp_allocations = 0;
+			auto start = std::chrono::steady_clock::now();
+			for(int i = 0; i < evaluations; i++){
+				std::pair<mpf_t*, mpf_t*> sinh_cosh = mpftoperations::SinhCosh(x);
+				mpftoperations::ReleaseValue(sinh_cosh.first);
+				mpftoperations::ReleaseValue(sinh_cosh.second);
+			}
+			printMeasurement("SinhCosh", precision, gmp_allocations, secondsSince(start), evaluations);
+		}
+		mpftoperations::ReleaseValue(x);
+		mpftoperations::ReleaseValue(minus_x);
+	}
+}
+
+// Measures Sin for arguments which need the reduction by many multiples of pi / 2.
+void benchmarkLargeArgumentSin(){
+	std::cout << "benchmark sin of large arguments\n";
+	const std::vector<double> arguments = {1e10, 1e100, 1e300};
+	for(unsigned int precision : BENCHMARK_PRECISIONS){
+		mpf_set_default_prec(precision);
+		const int evaluations = std::max(1, OPERATIONS_PER_MEASUREMENT / (int)precision / 20);
+		for(double argument : arguments){
+			mpf_t* x = mpftoperations::ToMpft(argument);
+			// the calculation of the bits of 2 / pi is not measured
+			mpftoperations::ReleaseValue(mpftoperations::Sin(x));
+			gmp_allocations = 0;
+			auto start = std::chrono::steady_clock::now();
+			for(int i = 0; i < evaluations; i++){
+				mpftoperations::ReleaseValue(mpftoperations::Sin(x));
+			}
+			std::ostringstream name;
+			name << "Sin(" << argument << ")";
+			printMeasurement(name.str(), precision, gmp_allocations, secondsSince(start), evaluations);
+			mpftoperations::ReleaseValue(x);
+		}
+	}
+}
+
+// Measures the inverse trigonometric functions for arguments with slow convergence of the plain series.
+void benchmarkInverseTrigonometric(){
+	std::cout << "benchmark inverse trigonometric functions\n";
+	for(unsigned int precision : BENCHMARK_PRECISIONS){
+		mpf_set_default_prec(precision);
+		const int evaluations = std::max(1, OPERATIONS_PER_MEASUREMENT / (int)precision / 20);
+		mpf_t* x = mpftoperations::ToMpft(0.95);
+		mpf_t* y = mpftoperations::ToMpft(-3.0);
+		std::vector<std::pair<std::string, mpf_t* (*)(mpf_t*)> > functions = {
+			{"Arctan", mpftoperations::Arctan},
+			{"Arcsin", mpftoperations::Arcsin},
+			{"Arccos", mpftoperations::Arccos},
+		};
+		for(unsigned int f = 0; f < functions.size(); f++){
+			gmp_allocations = 0;
+			auto start = std::chrono::steady_clock::now();
+			for(int i = 0; i < evaluations; i++){
+				mpftoperations::ReleaseValue(functions[f].second(x));
+			}
+			printMeasurement(functions[f].first, precision, gmp_allocations, secondsSince(start), evaluations);
+		}
+		gmp_allocations = 0;
+		auto start = std::chrono::steady_clock::now();
+		for(int i = 0; i < evaluations; i++){
+			mpftoperations::ReleaseValue(mpftoperations::Atan2(y, x));
+		}
+		printMeasurement("Atan2", precision, gmp_allocations, secondsSince(start), evaluations);
+		mpftoperations::ReleaseValue(x);
+		mpftoperations::ReleaseValue(y);
+	}
+}
+
+// Measures Pow for an integral, a fractional and a mixed exponent.
+void benchmarkPow(){
+	std::cout << "benchmark pow\n";
+	const std::vector<double> exponents = {37.0, 0.3, 2.5};
+	for(unsigned int precision : BENCHMARK_PRECISIONS){
+		mpf_set_default_prec(precision);
+		mpf_t* x = mpftoperations::ToMpft(1.7);
+		// the calculation of the cached constants is not measured
+		mpftoperations::ReleaseValue(mpftoperations::Pow(x, 0.3));
+		const int evaluations = std::max(1, OPERATIONS_PER_MEASUREMENT / (int)precision / 20);
+		for(double exponent : exponents){
+			mpf_t* p = mpftoperations::ToMpft(exponent);
+			gmp_allocations = 0;
+			auto start = std::chrono::steady_clock::now();
+			for(int i = 0; i < evaluations; i++){
+				mpftoperations::ReleaseValue(mpftoperations::Pow(x, p));
+			}
+			std::ostringstream name;
+			name << "Pow(1.7, " << exponent << ")";
+			printMeasurement(name.str(), precision, gmp_allocations, secondsSince(start), evaluations);
+			mpftoperations::ReleaseValue(p);
+		}
+		mpftoperations::ReleaseValue(x);
+	}
+}
+
+// Measures functions which need cached constants if two precisions are used alternately,
+// like statistics at a low precision and the main calculation at a high precision.
+void benchmarkAlternatingPrecisions(){
+	std::cout << "benchmark alternating precisions\n";
+	const std::vector<unsigned int> high_precisions = {1024, 4096, 16384};
+	const unsigned int low_precision = 128;
+	const int alternations = 20;
+	for(unsigned int precision : high_precisions){
+		gmp_allocations = 0;
+		auto start = std::chrono::steady_clock::now();
+		for(int i = 0; i < alternations; i++){
+			for(unsigned int current : {low_precision, precision}){
+				mpf_set_default_prec(current);
+				mpf_t* x = mpftoperations::ToMpft(0.7);
+				mpftoperations::ReleaseValue(mpftoperations::Sin(x));
+				mpftoperations::ReleaseValue(mpftoperations::Exp(x));
+				mpftoperations::ReleaseValue(mpftoperations::LogE(x));
+				mpftoperations::ReleaseValue(x);
+			}
+		}
+		printMeasurement("Sin, Exp and LogE", precision, gmp_allocations, secondsSince(start), alternations);
+	}
+}
+
+// Measures the elementary functions, which are mainly evaluated by series.
+void benchmarkFunctions(){
+	std::cout << "benchmark elementary functions\n";
+	for(unsigned int precision : BENCHMARK_PRECISIONS){
+		mpf_set_default_prec(precision);
+		const int evaluations = std::max(1, OPERATIONS_PER_MEASUREMENT / (int)precision / 20);
+		mpf_t* x = mpftoperations::ToMpft(0.7);
+		std::vector<std::pair<std::string, mpf_t* (*)(mpf_t*)> > functions = {
+			{"Exp", mpftoperations::Exp},
+			{"LogE", mpftoperations::LogE},
+			{"Sin", mpftoperations::Sin},
+			{"Cos", mpftoperations::Cos},
+			{"Tan", mpftoperations::Tan},
+			{"Sinh", mpftoperations::Sinh},
+			{"Cosh", mpftoperations::Cosh},
+			{"Tanh", mpftoperations::Tanh},
+			{"Asinh", mpftoperations::Asinh},
+			{"Atanh", mpftoperations::Atanh},
+		};
+		for(unsigned int f = 0; f < functions.size(); f++){
+			gmp_allocations = 0;
+			auto start = std::chrono::steady_clock::now();
+			for(int i = 0; i < evaluations; i++){
+				mpftoperations::ReleaseValue(functions[f].second(x));
+			}
+			printMeasurement(functions[f].first, precision, gmp_allocations, secondsSince(start), evaluations);
+		}
+		mpftoperations::ReleaseValue(x);
+	}
+}
+
+// Compares the release of temporaries by hand with the release by an arena.
+void benchmarkArena(){
+	std::cout << "benchmark release of temporaries\n";
+	const int temporaries = 16;
+	for(unsigned int precision : BENCHMARK_PRECISIONS){
+		mpf_set_default_prec(precision);
+		const int scopes = OPERATIONS_PER_MEASUREMENT / temporaries;
+		mpf_t* a = mpftoperations::GetPi();
+		{
+			std::vector<mpf_t*> values(temporaries);
+			gmp_allocations = 0;
+			auto start = std::chrono::steady_clock::now();
+			for(int i = 0; i < scopes; i++){
+				for(int k = 0; k < temporaries; k++){
+					values[k] = mpftoperations::Multiply2Exp(a, k);
+				}
+				for(int k = 0; k < temporaries; k++){
+					mpftoperations::ReleaseValue(values[k]);
+				}
+			}
+			printMeasurement("ReleaseValue by hand", precision, gmp_allocations, secondsSince(start), scopes * temporaries);
+		}
+		{
+			gmp_allocations = 0;
+			auto start = std::chrono::steady_clock::now();
+			for(int i = 0; i < scopes; i++){
+				ScopedMpftArena arena;
+				for(int k = 0; k < temporaries; k++){
+					mpftoperations::Multiply2Exp(a, k);
+				}
+			}
+			printMeasurement("ScopedMpftArena", precision, gmp_allocations, secondsSince(start), scopes * temporaries);
+		}
+		mpftoperations::ReleaseValue(a);
+	}
+}
+
+int start_benchmarks(int argv, char * argc[]) {
+	// has to be done before any mpf_t is initialized
+	mp_set_memory_functions(countingAllocate, countingReallocate, countingFree);
+	// With --limb-allocator all requests up to the largest size class are served by the limb allocator,
+	// hence only the remaining requests are counted as allocations.
+	for(int i = 1; i < argv; i++){
+		std::string argument(argc[i]);
+		if(argument == "--limb-allocator" || argument == "--huge-pages"){
+			LimbAllocator::Install(argument == "--huge-pages");
+			std::cout << "limb allocator installed" << (argument == "--huge-pages" ? " with huge pages" : "") << "\n";
+		}
+	}
+	Configuration::setInitialPrecision(64);
+	Configuration::setCheckPrecisionMode(configuration::CHECK_PRECISION_NEVER);
+	benchmarkPool();
+	benchmarkAllocations();
+	benchmarkThreads();
+	benchmarkReal();
+	benchmarkArena();
+	benchmarkPrecisionCheck();
+	benchmarkIncrementalConstants();
+	benchmarkPi();
+	benchmarkExp();
+	benchmarkLog();
+	benchmarkSinCos();
+	benchmarkAlgorithms();
+	benchmarkHyperbolic();
+	benchmarkLargeArgumentSin();
+	benchmarkInverseTrigonometric();
+	benchmarkPow();
+	benchmarkAlternatingPrecisions();
+	benchmarkFunctions();
+	if(LimbAllocator::IsInstalled()){
+		std::cout << "limb allocator: bytes in use=" << LimbAllocator::GetBytesInUse()
+			<< " bytes reserved=" << LimbAllocator::GetBytesReserved() << std::endl;
+	}
+	return 0;
+}
+
+} // namespace arbitraryprecisioncalculation
+
+int main(int argv, char * argc[]) {
+	return arbitraryprecisioncalculation::start_benchmarks(argv, argc);
+}
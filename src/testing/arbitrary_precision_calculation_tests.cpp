@@ -40,10 +40,17 @@
 #include <algorithm>
 #include <assert.h>
 #include <cfloat>
+#include <climits>
 #include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <future>
 #include <gmp.h>
 #include <iostream>
+#include <limits>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "arbitrary_precision_calculation/arbitraryprecisioncalculation.h"
@@ -861,6 +868,1703 @@ int testLongLongToMpft(){
 	return 0;
 }
 
+int testStoreAndLoadMpft(){
+	std::cout << "start store and load mpf_t test.\n";
+	const char* file_name = "test_store_and_load_mpft.tmp";
+	int prev_prec = mpf_get_default_prec();
+	std::vector<mpf_t*> stored;
+	std::vector<unsigned int> precisions = {64, 256, 1000};
+	for(unsigned int precision : precisions){
+		mpf_set_default_prec(precision);
+		stored.push_back(arbitraryprecisioncalculation::mpftoperations::GetPi());
+		stored.push_back(arbitraryprecisioncalculation::mpftoperations::ToMpft(-1.5e-200));
+	}
+	stored.push_back(arbitraryprecisioncalculation::mpftoperations::GetPlusInfinity());
+	stored.push_back(arbitraryprecisioncalculation::mpftoperations::GetUndefined());
+	{
+		std::ofstream output(file_name);
+		for(mpf_t* value : stored){
+			arbitraryprecisioncalculation::mpftoperations::StoreMpft(value, &output);
+		}
+	}
+	// loading has to restore the stored precision independently of the current precision
+	mpf_set_default_prec(precisions[1]);
+	{
+		std::ifstream input(file_name);
+		for(mpf_t* value : stored){
+			mpf_t* loaded = arbitraryprecisioncalculation::mpftoperations::LoadMpft(&input);
+			int result_should_be_true = (loaded == value) || (!arbitraryprecisioncalculation::mpftoperations::IsUndefined(loaded)
+					&& mpf_get_prec(*loaded) == mpf_get_prec(*value) && mpf_cmp(*loaded, *value) == 0);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(loaded);
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+		}
+	}
+	std::remove(file_name);
+	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(stored);
+	mpf_set_default_prec(prev_prec);
+	std::cout << "finished store and load mpf_t test successfully.\n";
+	return 0;
+}
+
+std::vector<mpf_t*> calculateThreadTestValues(){
+	std::vector<mpf_t*> res;
+	res.push_back(arbitraryprecisioncalculation::mpftoperations::GetPi());
+	res.push_back(arbitraryprecisioncalculation::mpftoperations::GetE());
+	for(int i = -5; i <= 5; i++){
+		mpf_t* v = arbitraryprecisioncalculation::mpftoperations::ToMpft(i * 0.7 + 0.1);
+		res.push_back(arbitraryprecisioncalculation::mpftoperations::Sin(v));
+		res.push_back(arbitraryprecisioncalculation::mpftoperations::Exp(v));
+		mpf_t* av = arbitraryprecisioncalculation::mpftoperations::Abs(v);
+		res.push_back(arbitraryprecisioncalculation::mpftoperations::LogE(av));
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(av);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(v);
+	}
+	return res;
+}
+
+int testThreads(){
+	std::cout << "start thread test.\n";
+	int prev_prec = mpf_get_default_prec();
+	int used_before = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+			- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+	// a new precision lets all threads initialize the cached constants concurrently
+	mpf_set_default_prec(prev_prec + 128);
+	const int number_of_threads = 4;
+	std::vector<std::vector<mpf_t*> > results(number_of_threads);
+	std::vector<std::thread> threads;
+	for(int t = 0; t < number_of_threads; t++){
+		threads.push_back(std::thread([&results, t](){
+			results[t] = calculateThreadTestValues();
+		}));
+	}
+	for(unsigned int t = 0; t < threads.size(); t++){
+		threads[t].join();
+	}
+	std::vector<mpf_t*> expected = calculateThreadTestValues();
+	for(int t = 0; t < number_of_threads; t++){
+		int result_should_be_true = (results[t].size() == expected.size());
+		for(unsigned int i = 0; i < expected.size() && result_should_be_true; i++){
+			result_should_be_true = (mpf_cmp(*(results[t][i]), *(expected[i])) == 0);
+		}
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+		// values created by other threads can be released by this thread
+		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(results[t]);
+	}
+	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(expected);
+	mpf_set_default_prec(prev_prec);
+	{
+		int used_after = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+				- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+		int result_should_be_true = (used_before == used_after);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "finished thread test successfully.\n";
+	return 0;
+}
+
+int testDestinationOperations(){
+	std::cout << "start destination operations test.\n";
+	int used_before = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+			- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+	std::vector<double> doubles = {INFINITY, -INFINITY, NAN, 0.0, 1.0, -2.5, 0.125, 3.0e20};
+	std::vector<mpf_t*> values = arbitraryprecisioncalculation::vectoroperations::GetVector(doubles);
+	std::vector<std::function<mpf_t*(const mpf_t*, const mpf_t*)> > operations = {
+		[](const mpf_t* a, const mpf_t* b){ return arbitraryprecisioncalculation::mpftoperations::Add(a, b); },
+		[](const mpf_t* a, const mpf_t* b){ return arbitraryprecisioncalculation::mpftoperations::Subtract(a, b); },
+		[](const mpf_t* a, const mpf_t* b){ return arbitraryprecisioncalculation::mpftoperations::Multiply(a, b); },
+		[](const mpf_t* a, const mpf_t* b){ return arbitraryprecisioncalculation::mpftoperations::Divide(a, b); },
+		[](const mpf_t* a, const mpf_t* b){ return arbitraryprecisioncalculation::mpftoperations::Max((mpf_t*)a, (mpf_t*)b); },
+		[](const mpf_t* a, const mpf_t* b){ return arbitraryprecisioncalculation::mpftoperations::Sqrt((mpf_t*)a); },
+		[](const mpf_t* a, const mpf_t* b){ return arbitraryprecisioncalculation::mpftoperations::Floor((mpf_t*)a); },
+		[](const mpf_t* a, const mpf_t* b){ return arbitraryprecisioncalculation::mpftoperations::Negate(a); },
+	};
+	std::vector<std::function<mpf_t*(mpf_t*, const mpf_t*, const mpf_t*)> > destination_operations = {
+		[](mpf_t* dst, const mpf_t* a, const mpf_t* b){ return arbitraryprecisioncalculation::mpftoperations::Add(dst, a, b); },
+		[](mpf_t* dst, const mpf_t* a, const mpf_t* b){ return arbitraryprecisioncalculation::mpftoperations::Subtract(dst, a, b); },
+		[](mpf_t* dst, const mpf_t* a, const mpf_t* b){ return arbitraryprecisioncalculation::mpftoperations::Multiply(dst, a, b); },
+		[](mpf_t* dst, const mpf_t* a, const mpf_t* b){ return arbitraryprecisioncalculation::mpftoperations::Divide(dst, a, b); },
+		[](mpf_t* dst, const mpf_t* a, const mpf_t* b){ return arbitraryprecisioncalculation::mpftoperations::Max(dst, (mpf_t*)a, (mpf_t*)b); },
+		[](mpf_t* dst, const mpf_t* a, const mpf_t* b){ return arbitraryprecisioncalculation::mpftoperations::Sqrt(dst, (mpf_t*)a); },
+		[](mpf_t* dst, const mpf_t* a, const mpf_t* b){ return arbitraryprecisioncalculation::mpftoperations::Floor(dst, (mpf_t*)a); },
+		[](mpf_t* dst, const mpf_t* a, const mpf_t* b){ return arbitraryprecisioncalculation::mpftoperations::Negate(dst, a); },
+	};
+	for(unsigned int o = 0; o < operations.size(); o++){
+		for(unsigned int i = 0; i < values.size(); i++){
+			for(unsigned int j = 0; j < values.size(); j++){
+				// a division by zero is not defined for mpf_t
+				if(o == 3 && doubles[j] == 0.0) continue;
+				mpf_t* expected = operations[o](values[i], values[j]);
+				// the destination is a regular value, a special value or one of the operands
+				for(int d = 0; d < 3; d++){
+					mpf_t* a = arbitraryprecisioncalculation::mpftoperations::Clone(values[i]);
+					mpf_t* b = arbitraryprecisioncalculation::mpftoperations::Clone(values[j]);
+					mpf_t* dst = (d == 0 ? arbitraryprecisioncalculation::mpftoperations::ToMpft(7.0) : (d == 1 ? arbitraryprecisioncalculation::mpftoperations::GetUndefined() : a));
+					// a regular destination is reused if the operands and the result are regular
+					bool regular = !arbitraryprecisioncalculation::mpftoperations::IsInfinite(dst) && !arbitraryprecisioncalculation::mpftoperations::IsUndefined(dst)
+							&& std::isfinite(doubles[i]) && std::isfinite(doubles[j]);
+					mpf_t* res = destination_operations[o](dst, a, b);
+					bool res_regular = !arbitraryprecisioncalculation::mpftoperations::IsInfinite(res) && !arbitraryprecisioncalculation::mpftoperations::IsUndefined(res);
+					int result_should_be_true = (res == expected || (res_regular && mpf_cmp(*res, *expected) == 0))
+							&& (!regular || !res_regular || res == dst);
+					if(!result_should_be_true){
+						std::cerr << "destination operation " << o << " failed for " << doubles[i] << " " << doubles[j] << " destination " << d << std::endl;
+					}
+					arbitraryprecisioncalculation::mpftoperations::ReleaseValue(res);
+					if(d != 2) arbitraryprecisioncalculation::mpftoperations::ReleaseValue(a);
+					arbitraryprecisioncalculation::mpftoperations::ReleaseValue(b);
+					assert(result_should_be_true);
+					if(!(result_should_be_true)) return 1;
+				}
+				arbitraryprecisioncalculation::mpftoperations::ReleaseValue(expected);
+			}
+		}
+	}
+	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(values);
+	{
+		int used_after = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+				- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+		int result_should_be_true = (used_before == used_after);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "finished destination operations test successfully.\n";
+	return 0;
+}
+
+int testScopedMpftArena(){
+	std::cout << "start scoped mpf_t arena test.\n";
+	int prev_prec = mpf_get_default_prec();
+	int used_before = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+			- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+	mpf_t* outer_result = NULL;
+	{
+		arbitraryprecisioncalculation::ScopedMpftArena outer;
+		mpf_t* inner_result = NULL;
+		{
+			arbitraryprecisioncalculation::ScopedMpftArena inner;
+			// constants which are cached during the arena are not owned by it
+			mpf_set_default_prec(prev_prec + 64);
+			mpf_t* pi = arbitraryprecisioncalculation::mpftoperations::GetPi();
+			mpf_t* a = arbitraryprecisioncalculation::mpftoperations::ToMpft(2.0);
+			// values may still be released by hand and the pool may reuse them
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(a);
+			a = arbitraryprecisioncalculation::mpftoperations::ToMpft(3.0);
+			inner_result = inner.Promote(arbitraryprecisioncalculation::mpftoperations::Multiply(pi, a));
+			inner.Promote(arbitraryprecisioncalculation::mpftoperations::GetUndefined());
+		}
+		int used = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+				- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+		mpf_t* pi = arbitraryprecisioncalculation::mpftoperations::GetPi();
+		mpf_t* expected = arbitraryprecisioncalculation::mpftoperations::ToMpft(3.0);
+		expected = arbitraryprecisioncalculation::mpftoperations::Multiply(expected, expected, pi);
+		int result_should_be_true = (used == used_before + 1 && mpf_cmp(*inner_result, *expected) == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+		// the promoted value is owned by the outer arena
+		outer_result = outer.Promote(arbitraryprecisioncalculation::mpftoperations::Add(inner_result, expected));
+	}
+	{
+		int used_after = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+				- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+		int result_should_be_true = (used_after == used_before + 1);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(outer_result);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	mpf_set_default_prec(prev_prec);
+	{
+		int used_after = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+				- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+		int result_should_be_true = (used_before == used_after);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "finished scoped mpf_t arena test successfully.\n";
+	return 0;
+}
+
+int testScopedMpftArenaThreads(){
+	std::cout << "start scoped mpf_t arena threads test.\n";
+	int prev_prec = mpf_get_default_prec();
+	int used_before = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+			- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+	// the released values are handed to the depot instead of the full depot being used
+	arbitraryprecisioncalculation::mpftoperations::TrimMpftPool();
+	const int number_of_values = 300;
+	std::promise<void> acquired;
+	std::promise<void> closed;
+	std::thread thread;
+	{
+		arbitraryprecisioncalculation::ScopedMpftArena arena;
+		// values released by hand are still in the log of the arena, but the pool hands them to other threads
+		std::vector<mpf_t*> values = arbitraryprecisioncalculation::vectoroperations::GetConstantVector(number_of_values, 1.5);
+		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(values);
+		thread = std::thread([&acquired, &closed](){
+			arbitraryprecisioncalculation::ScopedMpftArena other_arena;
+			std::vector<mpf_t*> other_values = arbitraryprecisioncalculation::vectoroperations::GetConstantVector(number_of_values, 2.5);
+			acquired.set_value();
+			closed.get_future().wait();
+		});
+		acquired.get_future().wait();
+	}
+	// the arena of this thread must not release the values owned by the arena of the other thread
+	int used_during = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+			- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+	closed.set_value();
+	thread.join();
+	mpf_set_default_prec(prev_prec);
+	{
+		int result_should_be_true = (used_during == used_before + number_of_values);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int used_after = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+				- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+		int result_should_be_true = (used_before == used_after);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "finished scoped mpf_t arena threads test successfully.\n";
+	return 0;
+}
+
+int testTrimMpftPool(){
+	std::cout << "start trim mpf_t pool test.\n";
+	int prev_prec = mpf_get_default_prec();
+	int used_before = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+			- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+	arbitraryprecisioncalculation::mpftoperations::TrimMpftPool();
+	int reserved_before = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesReserved();
+	mpf_set_default_prec(4096);
+	// a temporary spike of values in use
+	std::vector<mpf_t*> values = arbitraryprecisioncalculation::vectoroperations::GetConstantVector(20000, 1.5);
+	int reserved_during = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesReserved();
+	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(values);
+	arbitraryprecisioncalculation::mpftoperations::TrimMpftPool();
+	{
+		int reserved_after = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesReserved();
+		int result_should_be_true = (reserved_during > reserved_before && reserved_after <= reserved_before);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		// the log of an open arena of another thread may reference released values, hence no memory block is freed
+		std::promise<void> opened;
+		std::promise<void> trimmed;
+		std::thread thread([&opened, &trimmed](){
+			arbitraryprecisioncalculation::ScopedMpftArena arena;
+			opened.set_value();
+			trimmed.get_future().wait();
+		});
+		opened.get_future().wait();
+		values = arbitraryprecisioncalculation::vectoroperations::GetConstantVector(20000, 1.5);
+		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(values);
+		arbitraryprecisioncalculation::mpftoperations::TrimMpftPool();
+		int reserved_with_arena = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesReserved();
+		trimmed.set_value();
+		thread.join();
+		arbitraryprecisioncalculation::mpftoperations::TrimMpftPool();
+		int reserved_after = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesReserved();
+		int result_should_be_true = (reserved_with_arena >= 20000 && reserved_after <= reserved_before);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	// released values beyond the limits lose their limbs but the values stay usable
+	arbitraryprecisioncalculation::Configuration::setMaximalCachedReleasedMpftValues(10);
+	arbitraryprecisioncalculation::Configuration::setMaximalCachedReleasedMpftLimbBytes(8 * 4096);
+	for(int round = 0; round < 3; round++){
+		values = arbitraryprecisioncalculation::vectoroperations::GetConstantVector(100, round + 0.5);
+		mpf_t* sum = arbitraryprecisioncalculation::vectoroperations::Add(values);
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::Compare(sum, 100 * (round + 0.5)) == 0);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(sum);
+		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(values);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		// surplus batches which are handed to the depot must not bypass the limit
+		const int maximal_values = 200;
+		arbitraryprecisioncalculation::Configuration::setMaximalCachedReleasedMpftValues(maximal_values);
+		arbitraryprecisioncalculation::Configuration::setMaximalCachedReleasedMpftLimbBytes(-1);
+		arbitraryprecisioncalculation::mpftoperations::TrimMpftPool();
+		long long bytes_before = arbitraryprecisioncalculation::LimbAllocator::GetBytesInUse();
+		values = arbitraryprecisioncalculation::vectoroperations::GetConstantVector(5000, 1.5);
+		long long bytes_during = arbitraryprecisioncalculation::LimbAllocator::GetBytesInUse();
+		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(values);
+		long long bytes_after = arbitraryprecisioncalculation::LimbAllocator::GetBytesInUse();
+		// the limbs of one value (compare mpf_init2)
+		long long value_bytes = arbitraryprecisioncalculation::LimbAllocator::GetAllocationSize((4096 / GMP_NUMB_BITS + 2) * sizeof(mp_limb_t));
+		int result_should_be_true = (bytes_during - bytes_before >= 5000 * value_bytes
+				&& bytes_after - bytes_before <= maximal_values * value_bytes);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	arbitraryprecisioncalculation::Configuration::setMaximalCachedReleasedMpftValues(-1);
+	arbitraryprecisioncalculation::Configuration::setMaximalCachedReleasedMpftLimbBytes(-1);
+	mpf_set_default_prec(prev_prec);
+	{
+		int used_after = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+				- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+		int result_should_be_true = (used_before == used_after);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "finished trim mpf_t pool test successfully.\n";
+	return 0;
+}
+
+int testLimbAllocator(){
+	std::cout << "start limb allocator test.\n";
+	{
+		int result_should_be_true = arbitraryprecisioncalculation::LimbAllocator::IsInstalled();
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	// size classes are multiples of eight and waste less than 25 percent
+	for(size_t size = 1; size <= 100000; size += (size < 5000 ? 1 : 97)){
+		size_t allocation_size = arbitraryprecisioncalculation::LimbAllocator::GetAllocationSize(size);
+		int result_should_be_true = (allocation_size >= size && allocation_size % 8 == 0 && (allocation_size <= 32 || allocation_size * 4 < size * 5 + 32));
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		size_t large = (1 << 20) + 1;
+		int result_should_be_true = (arbitraryprecisioncalculation::LimbAllocator::GetAllocationSize(large) == large);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	// the counter of bytes in use follows the allocations of gmp, also if values are freed by another thread
+	long long bytes_before = arbitraryprecisioncalculation::LimbAllocator::GetBytesInUse();
+	const int NUMBER_OF_VALUES = 100;
+	const mp_bitcnt_t precision = 4096;
+	std::vector<__mpf_struct> values(NUMBER_OF_VALUES);
+	for(int i = 0; i < NUMBER_OF_VALUES; i++){
+		mpf_init2(&values[i], precision);
+		mpf_set_d(&values[i], i + 0.5);
+	}
+	{
+		long long expected = NUMBER_OF_VALUES * (long long)arbitraryprecisioncalculation::LimbAllocator::GetAllocationSize(
+				(values[0]._mp_prec + 1) * sizeof(mp_limb_t));
+		int result_should_be_true = (arbitraryprecisioncalculation::LimbAllocator::GetBytesInUse() - bytes_before == expected
+				&& arbitraryprecisioncalculation::LimbAllocator::GetBytesReserved() >= expected);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::thread thread([&values](){
+		for(unsigned int i = 0; i < values.size(); i++){
+			mpf_mul(&values[i], &values[i], &values[i]);
+			mpf_clear(&values[i]);
+		}
+	});
+	thread.join();
+	{
+		int result_should_be_true = (arbitraryprecisioncalculation::LimbAllocator::GetBytesInUse() == bytes_before);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "finished limb allocator test successfully.\n";
+	return 0;
+}
+
+// Adds or subtracts a and 2^exponent_b and returns whether an increase of precision is recommended afterwards.
+bool isIncreasePrecisionRecommendedAfter(mpf_t* a, int exponent_b, bool subtraction){
+	arbitraryprecisioncalculation::Configuration::ResetIncreasePrecisionRecommended();
+	mpf_t* one = arbitraryprecisioncalculation::mpftoperations::ToMpft(1.0);
+	mpf_t* b = arbitraryprecisioncalculation::mpftoperations::Multiply2Exp(one, exponent_b);
+	mpf_t* res = subtraction ? arbitraryprecisioncalculation::mpftoperations::Subtract(a, b)
+			: arbitraryprecisioncalculation::mpftoperations::Add(a, b);
+	bool result = arbitraryprecisioncalculation::Configuration::isIncreasePrecisionRecommended();
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(one);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(b);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(res);
+	arbitraryprecisioncalculation::Configuration::ResetIncreasePrecisionRecommended();
+	return result;
+}
+
+int testPrecisionCheck(){
+	std::cout << "start precision check test.\n";
+	int used_before = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+			- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+	int prev_prec = mpf_get_default_prec();
+	int prev_margin = arbitraryprecisioncalculation::Configuration::getPrecisionSafetyMargin();
+	// 320 bits are available in 5 limbs, hence an increase is recommended if 192 bits are lost
+	mpf_set_default_prec(256);
+	arbitraryprecisioncalculation::Configuration::setPrecisionSafetyMargin(128);
+	mpf_t* one = arbitraryprecisioncalculation::mpftoperations::ToMpft(1.0);
+	mpf_t* tiny = arbitraryprecisioncalculation::mpftoperations::Multiply2Exp(one, -130);
+	mpf_t* slightly_below_one = arbitraryprecisioncalculation::mpftoperations::Subtract(one, tiny);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(tiny);
+	{
+		int result_should_be_true = (!isIncreasePrecisionRecommendedAfter(one, -100, false)
+				&& isIncreasePrecisionRecommendedAfter(one, -200, false)
+				&& !isIncreasePrecisionRecommendedAfter(one, 100, true)
+				&& isIncreasePrecisionRecommendedAfter(one, 200, true)
+				&& !isIncreasePrecisionRecommendedAfter(one, 0, true)
+				&& !isIncreasePrecisionRecommendedAfter(slightly_below_one, -131, false)
+				&& isIncreasePrecisionRecommendedAfter(slightly_below_one, -200, true));
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		// cancellation of 130 bits over a chain of borrows: 1 - (1 - 2^-130)
+		arbitraryprecisioncalculation::Configuration::ResetIncreasePrecisionRecommended();
+		mpf_t* difference = arbitraryprecisioncalculation::mpftoperations::Subtract(one, slightly_below_one);
+		int result_should_be_true = !arbitraryprecisioncalculation::Configuration::isIncreasePrecisionRecommended();
+		arbitraryprecisioncalculation::Configuration::setPrecisionSafetyMargin(200);
+		difference = arbitraryprecisioncalculation::mpftoperations::Subtract(difference, one, slightly_below_one);
+		result_should_be_true = result_should_be_true && arbitraryprecisioncalculation::Configuration::isIncreasePrecisionRecommended();
+		arbitraryprecisioncalculation::Configuration::ResetIncreasePrecisionRecommended();
+		arbitraryprecisioncalculation::Configuration::setPrecisionSafetyMargin(128);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(difference);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		// sampled checks
+		arbitraryprecisioncalculation::Configuration::setCheckPrecisionProbability(0.0);
+		int result_should_be_true = !isIncreasePrecisionRecommendedAfter(one, -200, false);
+		arbitraryprecisioncalculation::Configuration::setCheckPrecisionProbability(0.5);
+		int recommendations = 0;
+		for(int i = 0; i < 1000; i++){
+			if(isIncreasePrecisionRecommendedAfter(one, -200, false)) recommendations++;
+		}
+		arbitraryprecisioncalculation::Configuration::setCheckPrecisionProbability(1.0);
+		result_should_be_true = result_should_be_true && recommendations > 400 && recommendations < 600;
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(one);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(slightly_below_one);
+	arbitraryprecisioncalculation::Configuration::setPrecisionSafetyMargin(prev_margin);
+	mpf_set_default_prec(prev_prec);
+	{
+		int used_after = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+				- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+		int result_should_be_true = (used_before == used_after);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "finished precision check test successfully.\n";
+	return 0;
+}
+
+int testPrecisionCheckPolicies(){
+	std::cout << "start precision check policies test.\n";
+	int used_before = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+			- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+	int prev_prec = mpf_get_default_prec();
+	int prev_margin = arbitraryprecisioncalculation::Configuration::getPrecisionSafetyMargin();
+	mpf_set_default_prec(256);
+	arbitraryprecisioncalculation::Configuration::setPrecisionSafetyMargin(128);
+	arbitraryprecisioncalculation::Configuration::ResetIncreasePrecisionRecommended();
+	mpf_t* one = arbitraryprecisioncalculation::mpftoperations::ToMpft(1.0);
+	mpf_t* tiny = arbitraryprecisioncalculation::mpftoperations::Multiply2Exp(one, -200);
+	{
+		// unchecked operations compute the same values but never recommend an increase of precision
+		mpf_t* sum = arbitraryprecisioncalculation::mpftoperations::Add<arbitraryprecisioncalculation::precisioncheck::Unchecked>(one, tiny);
+		mpf_t* difference = arbitraryprecisioncalculation::mpftoperations::Subtract<arbitraryprecisioncalculation::precisioncheck::Unchecked>(sum, tiny);
+		sum = arbitraryprecisioncalculation::mpftoperations::AddNoCheck(sum, sum, tiny);
+		std::vector<mpf_t*> ones = arbitraryprecisioncalculation::vectoroperations::GetConstantVector(3, one);
+		std::vector<mpf_t*> tinys = arbitraryprecisioncalculation::vectoroperations::GetConstantVector(3, tiny);
+		std::vector<mpf_t*> sums = arbitraryprecisioncalculation::vectoroperations::Add<arbitraryprecisioncalculation::precisioncheck::Unchecked>(ones, tinys);
+		std::vector<mpf_t*> differences = arbitraryprecisioncalculation::vectoroperations::Subtract<arbitraryprecisioncalculation::precisioncheck::Unchecked>(sums, tinys);
+		mpf_t* total = arbitraryprecisioncalculation::vectoroperations::Add<arbitraryprecisioncalculation::precisioncheck::Unchecked>(tinys);
+		int result_should_be_true = (!arbitraryprecisioncalculation::Configuration::isIncreasePrecisionRecommended()
+				&& arbitraryprecisioncalculation::mpftoperations::Compare(difference, one) == 0
+				&& arbitraryprecisioncalculation::vectoroperations::Equals(differences, ones)
+				&& arbitraryprecisioncalculation::mpftoperations::Compare(total, 3.0 * pow(2.0, -200)) == 0);
+		mpf_t* checked_sum = arbitraryprecisioncalculation::mpftoperations::Add<arbitraryprecisioncalculation::precisioncheck::Checked>(one, tiny);
+		result_should_be_true = result_should_be_true && arbitraryprecisioncalculation::Configuration::isIncreasePrecisionRecommended();
+		arbitraryprecisioncalculation::Configuration::ResetIncreasePrecisionRecommended();
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(sum);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(difference);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(total);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(checked_sum);
+		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(ones);
+		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(tinys);
+		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(sums);
+		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(differences);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		// sampled operations check every fourth operation, even if checks are disabled in the configuration
+		arbitraryprecisioncalculation::Configuration::setCheckPrecisionMode(arbitraryprecisioncalculation::configuration::CHECK_PRECISION_NEVER);
+		int recommendations = 0;
+		for(int i = 0; i < 100; i++){
+			mpf_t* sum = arbitraryprecisioncalculation::mpftoperations::Add<arbitraryprecisioncalculation::precisioncheck::Sampled<4> >(one, tiny);
+			if(arbitraryprecisioncalculation::Configuration::isIncreasePrecisionRecommended()) recommendations++;
+			arbitraryprecisioncalculation::Configuration::ResetIncreasePrecisionRecommended();
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(sum);
+		}
+		mpf_t* checked_sum = arbitraryprecisioncalculation::mpftoperations::Add(one, tiny);
+		int result_should_be_true = (recommendations == 25 && !arbitraryprecisioncalculation::Configuration::isIncreasePrecisionRecommended());
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(checked_sum);
+		arbitraryprecisioncalculation::Configuration::setCheckPrecisionMode(arbitraryprecisioncalculation::configuration::CHECK_PRECISION_ALWAYS_EXCEPT_STATISTICS);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(one);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(tiny);
+	arbitraryprecisioncalculation::Configuration::setPrecisionSafetyMargin(prev_margin);
+	mpf_set_default_prec(prev_prec);
+	{
+		int used_after = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+				- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+		int result_should_be_true = (used_before == used_after);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "finished precision check policies test successfully.\n";
+	return 0;
+}
+
+int testPrecisionController(){
+	std::cout << "start precision controller test.\n";
+	int used_before = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+			- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+	int prev_prec = mpf_get_default_prec();
+	int prev_margin = arbitraryprecisioncalculation::Configuration::getPrecisionSafetyMargin();
+	arbitraryprecisioncalculation::Configuration::setPrecisionSafetyMargin(128);
+	arbitraryprecisioncalculation::Configuration::ResetIncreasePrecisionRecommended();
+	mpf_t* one = arbitraryprecisioncalculation::mpftoperations::ToMpft(1.0);
+	{
+		// the worst loss is recorded: 300 lost bits and a margin of 128 bits need 7 limbs, i.e. a precision of 321 bits
+		mpf_set_default_prec(256);
+		mpf_t* tiny = NULL;
+		mpf_t* sum = NULL;
+		const std::vector<int> losses = {250, 300, 200};
+		for(int loss : losses){
+			tiny = arbitraryprecisioncalculation::mpftoperations::Multiply2Exp(tiny, one, -loss);
+			sum = arbitraryprecisioncalculation::mpftoperations::Add(sum, one, tiny);
+		}
+		int result_should_be_true = arbitraryprecisioncalculation::Configuration::isIncreasePrecisionRecommended();
+		result_should_be_true = result_should_be_true && arbitraryprecisioncalculation::Configuration::getRecommendedPrecision() == 321;
+		// exact growth reaches a sufficient precision at once
+		arbitraryprecisioncalculation::Configuration::setPrecisionGrowthStrategy(arbitraryprecisioncalculation::configuration::PRECISION_GROWTH_EXACT);
+		arbitraryprecisioncalculation::mpftoperations::IncreasePrecision();
+		result_should_be_true = result_should_be_true && mpf_get_default_prec() == 384;
+		arbitraryprecisioncalculation::Configuration::ResetIncreasePrecisionRecommended();
+		result_should_be_true = result_should_be_true && arbitraryprecisioncalculation::Configuration::getRecommendedPrecision() == 0
+				&& !isIncreasePrecisionRecommendedAfter(one, -300, false) && isIncreasePrecisionRecommendedAfter(one, -400, false);
+		// without recommendation exact growth adds one limb
+		arbitraryprecisioncalculation::mpftoperations::IncreasePrecision();
+		result_should_be_true = result_should_be_true && mpf_get_default_prec() == 448;
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(tiny);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(sum);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		mpf_set_default_prec(256);
+		arbitraryprecisioncalculation::Configuration::setPrecisionGrowthStrategy(arbitraryprecisioncalculation::configuration::PRECISION_GROWTH_GEOMETRIC);
+		arbitraryprecisioncalculation::Configuration::setPrecisionGrowthFactor(2.0);
+		isIncreasePrecisionRecommendedAfter(one, -300, false);
+		arbitraryprecisioncalculation::Configuration::RecommendIncreasePrecision(321);
+		arbitraryprecisioncalculation::mpftoperations::IncreasePrecision();
+		int result_should_be_true = (mpf_get_default_prec() == 512);
+		arbitraryprecisioncalculation::Configuration::RecommendIncreasePrecision(2000);
+		arbitraryprecisioncalculation::mpftoperations::IncreasePrecision();
+		result_should_be_true = result_should_be_true && mpf_get_default_prec() >= 2000 && mpf_get_default_prec() < 2064;
+		arbitraryprecisioncalculation::Configuration::setPrecisionGrowthStrategy(arbitraryprecisioncalculation::configuration::PRECISION_GROWTH_LINEAR);
+		arbitraryprecisioncalculation::Configuration::setPrecisionGrowthFactor(1.5);
+		arbitraryprecisioncalculation::Configuration::ResetIncreasePrecisionRecommended();
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(one);
+	arbitraryprecisioncalculation::Configuration::setPrecisionSafetyMargin(prev_margin);
+	mpf_set_default_prec(prev_prec);
+	{
+		int used_after = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+				- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+		int result_should_be_true = (used_before == used_after);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "finished precision controller test successfully.\n";
+	return 0;
+}
+
+int testPiAlgorithms(){
+	std::cout << "start pi algorithms test.\n";
+	int used_before = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+			- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+	int prev_prec = mpf_get_default_prec();
+	const std::vector<int> precisions = {64, 256, 1024, 4096};
+	for(int precision : precisions){
+		mpf_set_default_prec(precision);
+		mpf_t* chudnovsky = arbitraryprecisioncalculation::constantcalculation::CalculatePiChudnovsky(1);
+		mpf_t* bbp = arbitraryprecisioncalculation::constantcalculation::CalculatePiBaileyBorweinPlouffe();
+		mpf_t* difference = arbitraryprecisioncalculation::mpftoperations::Subtract(chudnovsky, bbp);
+		difference = arbitraryprecisioncalculation::mpftoperations::Abs(difference, difference);
+		mpf_t* one = arbitraryprecisioncalculation::mpftoperations::ToMpft(1.0);
+		mpf_t* bound = arbitraryprecisioncalculation::mpftoperations::Multiply2Exp(one, 16 - precision);
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::Compare(difference, bound) < 0);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(chudnovsky);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(bbp);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(difference);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(one);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(bound);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		// the parallel splitting calculates exactly the same value
+		mpf_set_default_prec(100000);
+		mpf_t* sequential = arbitraryprecisioncalculation::constantcalculation::CalculatePiChudnovsky(1);
+		mpf_t* parallel = arbitraryprecisioncalculation::constantcalculation::CalculatePiChudnovsky(4);
+		int result_should_be_true = (mpf_cmp(*sequential, *parallel) == 0);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(sequential);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(parallel);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	mpf_set_default_prec(prev_prec);
+	{
+		int used_after = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+				- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+		int result_should_be_true = (used_before == used_after);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "finished pi algorithms test successfully.\n";
+	return 0;
+}
+
+int testExpArgumentReduction(){
+	std::cout << "start exp argument reduction test.\n";
+	int used_before = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+			- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+	int prev_prec = mpf_get_default_prec();
+	const std::vector<int> precisions = {64, 1024, 16384};
+	const std::vector<double> arguments = {1e-30, -0.3, 0.7, 123.456, -745.5, 1e6};
+	for(int precision : precisions){
+		mpf_set_default_prec(precision);
+		mpf_t* one = arbitraryprecisioncalculation::mpftoperations::ToMpft(1.0);
+		mpf_t* bound = arbitraryprecisioncalculation::mpftoperations::Multiply2Exp(one, 8 - precision);
+		{
+			// exp(ln(2)) = 2
+			mpf_t* ln2 = arbitraryprecisioncalculation::mpftoperations::GetLn2();
+			mpf_t* two = arbitraryprecisioncalculation::mpftoperations::Exp(ln2);
+			two = arbitraryprecisioncalculation::mpftoperations::Multiply2Exp(two, two, -1);
+			two = arbitraryprecisioncalculation::mpftoperations::Subtract(two, two, one);
+			two = arbitraryprecisioncalculation::mpftoperations::Abs(two, two);
+			int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::Compare(two, bound) < 0);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(ln2);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(two);
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+		}
+		for(double argument : arguments){
+			// exp(a) * exp(-a) = 1
+			mpf_t* a = arbitraryprecisioncalculation::mpftoperations::ToMpft(argument);
+			mpf_t* minus_a = arbitraryprecisioncalculation::mpftoperations::Negate(a);
+			mpf_t* exp_a = arbitraryprecisioncalculation::mpftoperations::Exp(a);
+			mpf_t* exp_minus_a = arbitraryprecisioncalculation::mpftoperations::Exp(minus_a);
+			mpf_t* product = arbitraryprecisioncalculation::mpftoperations::Multiply(exp_a, exp_minus_a);
+			product = arbitraryprecisioncalculation::mpftoperations::Subtract(product, product, one);
+			product = arbitraryprecisioncalculation::mpftoperations::Abs(product, product);
+			int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::Compare(product, bound) < 0);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(a);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(minus_a);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(exp_a);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(exp_minus_a);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(product);
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+		}
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(one);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(bound);
+	}
+	mpf_set_default_prec(prev_prec);
+	{
+		int used_after = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+				- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+		int result_should_be_true = (used_before == used_after);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "finished exp argument reduction test successfully.\n";
+	return 0;
+}
+
+int testLogArgumentReduction(){
+	std::cout << "start log argument reduction test.\n";
+	int used_before = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+			- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+	int prev_prec = mpf_get_default_prec();
+	// the largest precision uses the arithmetic-geometric mean
+	const std::vector<int> precisions = {64, 1024, 8192};
+	const std::vector<double> arguments = {1e-300, 0.3, 0.74, 0.99, 1.0 + 1e-12, 1.0078125, 1.49, 2.0, 12345.678, 1e300};
+	for(int precision : precisions){
+		mpf_set_default_prec(precision);
+		mpf_t* one = arbitraryprecisioncalculation::mpftoperations::ToMpft(1.0);
+		mpf_t* bound = arbitraryprecisioncalculation::mpftoperations::Multiply2Exp(one, 16 - precision);
+		{
+			// ln(2) is the cached constant
+			mpf_t* two = arbitraryprecisioncalculation::mpftoperations::ToMpft(2.0);
+			mpf_t* log_two = arbitraryprecisioncalculation::mpftoperations::LogE(two);
+			mpf_t* ln2 = arbitraryprecisioncalculation::mpftoperations::GetLn2();
+			log_two = arbitraryprecisioncalculation::mpftoperations::Subtract(log_two, log_two, ln2);
+			log_two = arbitraryprecisioncalculation::mpftoperations::Abs(log_two, log_two);
+			int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::Compare(log_two, bound) < 0);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(two);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(log_two);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(ln2);
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+		}
+		for(double argument : arguments){
+			// exp(ln(a)) / a = 1
+			mpf_t* a = arbitraryprecisioncalculation::mpftoperations::ToMpft(argument);
+			mpf_t* log_a = arbitraryprecisioncalculation::mpftoperations::LogE(a);
+			mpf_t* exp_log_a = arbitraryprecisioncalculation::mpftoperations::Exp(log_a);
+			mpf_t* quotient = arbitraryprecisioncalculation::mpftoperations::Divide(exp_log_a, a);
+			quotient = arbitraryprecisioncalculation::mpftoperations::Subtract(quotient, quotient, one);
+			quotient = arbitraryprecisioncalculation::mpftoperations::Abs(quotient, quotient);
+			int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::Compare(quotient, bound) < 0);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(a);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(log_a);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(exp_log_a);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(quotient);
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+		}
+		{
+			// the relative error stays small close to 1
+			mpf_t* tiny = arbitraryprecisioncalculation::mpftoperations::Multiply2Exp(one, -precision / 2);
+			mpf_t* a = arbitraryprecisioncalculation::mpftoperations::Add(one, tiny);
+			mpf_t* log_a = arbitraryprecisioncalculation::mpftoperations::LogE(a);
+			mpf_set_default_prec(2 * precision);
+			mpf_t* more_accurate = arbitraryprecisioncalculation::mpftoperations::LogE(a);
+			mpf_t* difference = arbitraryprecisioncalculation::mpftoperations::Subtract(log_a, more_accurate);
+			difference = arbitraryprecisioncalculation::mpftoperations::Abs(difference, difference);
+			mpf_t* relative_bound = arbitraryprecisioncalculation::mpftoperations::Multiply(more_accurate, bound);
+			int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::Compare(difference, relative_bound) < 0);
+			mpf_set_default_prec(precision);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(tiny);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(a);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(log_a);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(more_accurate);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(difference);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(relative_bound);
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+		}
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(one);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(bound);
+	}
+	mpf_set_default_prec(prev_prec);
+	{
+		int used_after = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+				- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+		int result_should_be_true = (used_before == used_after);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "finished log argument reduction test successfully.\n";
+	return 0;
+}
+
+int testSinCos(){
+	std::cout << "start sincos test.\n";
+	int used_before = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+			- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+	int prev_prec = mpf_get_default_prec();
+	const std::vector<int> precisions = {64, 1024, 4096};
+	const std::vector<double> arguments = {0.0, 1e-20, 0.5, -0.78, 0.79, 2.0, -3.0, 3.15, 4.5, -100.25, 12345.678};
+	for(int precision : precisions){
+		mpf_set_default_prec(precision);
+		mpf_t* one = arbitraryprecisioncalculation::mpftoperations::ToMpft(1.0);
+		mpf_t* bound = arbitraryprecisioncalculation::mpftoperations::Multiply2Exp(one, 8 - precision);
+		for(double argument : arguments){
+			mpf_t* a = arbitraryprecisioncalculation::mpftoperations::ToMpft(argument);
+			std::pair<mpf_t*, mpf_t*> sin_cos = arbitraryprecisioncalculation::mpftoperations::SinCos(a);
+			mpf_t* sin_a = arbitraryprecisioncalculation::mpftoperations::Sin(a);
+			mpf_t* cos_a = arbitraryprecisioncalculation::mpftoperations::Cos(a);
+			mpf_t* tan_a = arbitraryprecisioncalculation::mpftoperations::Tan(a);
+			mpf_t* quotient = arbitraryprecisioncalculation::mpftoperations::Divide(sin_cos.first, sin_cos.second);
+			{
+				// the fused calculation gives the same values as the single functions
+				int result_should_be_true = (mpf_cmp(*sin_cos.first, *sin_a) == 0 && mpf_cmp(*sin_cos.second, *cos_a) == 0
+						&& mpf_cmp(*tan_a, *quotient) == 0);
+				assert(result_should_be_true);
+				if(!(result_should_be_true)) return 1;
+			}
+			{
+				// sin(a)^2 + cos(a)^2 = 1
+				mpf_t* sum = arbitraryprecisioncalculation::mpftoperations::Multiply(sin_a, sin_a);
+				mpf_t* cos_square = arbitraryprecisioncalculation::mpftoperations::Multiply(cos_a, cos_a);
+				sum = arbitraryprecisioncalculation::mpftoperations::Add(sum, sum, cos_square);
+				sum = arbitraryprecisioncalculation::mpftoperations::Subtract(sum, sum, one);
+				sum = arbitraryprecisioncalculation::mpftoperations::Abs(sum, sum);
+				int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::Compare(sum, bound) < 0);
+				arbitraryprecisioncalculation::mpftoperations::ReleaseValue(sum);
+				arbitraryprecisioncalculation::mpftoperations::ReleaseValue(cos_square);
+				assert(result_should_be_true);
+				if(!(result_should_be_true)) return 1;
+			}
+			{
+				// the destination variant reuses the destinations
+				mpf_t* dst_sin = sin_cos.first;
+				mpf_t* dst_cos = sin_cos.second;
+				sin_cos = arbitraryprecisioncalculation::mpftoperations::SinCos(dst_sin, dst_cos, a);
+				int result_should_be_true = (sin_cos.first == dst_sin && sin_cos.second == dst_cos
+						&& mpf_cmp(*sin_cos.first, *sin_a) == 0 && mpf_cmp(*sin_cos.second, *cos_a) == 0);
+				assert(result_should_be_true);
+				if(!(result_should_be_true)) return 1;
+			}
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(a);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(sin_cos.first);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(sin_cos.second);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(sin_a);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(cos_a);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(tan_a);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(quotient);
+		}
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(one);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(bound);
+	}
+	{
+		std::pair<mpf_t*, mpf_t*> sin_cos = arbitraryprecisioncalculation::mpftoperations::SinCos(
+				arbitraryprecisioncalculation::mpftoperations::GetPlusInfinity());
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::IsUndefined(sin_cos.first)
+				&& arbitraryprecisioncalculation::mpftoperations::IsUndefined(sin_cos.second));
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		arbitraryprecisioncalculation::Real a(arbitraryprecisioncalculation::mpftoperations::ToMpft(0.3));
+		std::pair<arbitraryprecisioncalculation::Real, arbitraryprecisioncalculation::Real> sin_cos = SinCos(a);
+		int result_should_be_true = (mpf_cmp(*sin_cos.first.Get(), *Sin(a).Get()) == 0
+				&& mpf_cmp(*sin_cos.second.Get(), *Cos(a).Get()) == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	mpf_set_default_prec(prev_prec);
+	{
+		int used_after = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+				- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+		int result_should_be_true = (used_before == used_after);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "finished sincos test successfully.\n";
+	return 0;
+}
+
+// Calculates sin(x) and cos(x) with the reduction by an explicitly calculated multiple of 2 pi in the higher precision.
+std::pair<mpf_t*, mpf_t*> sinCosWithExplicitReduction(mpf_t* x, int precision){
+	int prev_prec = mpf_get_default_prec();
+	mpf_set_default_prec(precision);
+	mpf_t* two_pi = arbitraryprecisioncalculation::mpftoperations::GetPi();
+	two_pi = arbitraryprecisioncalculation::mpftoperations::Multiply2Exp(two_pi, two_pi, 1);
+	mpf_t* k = arbitraryprecisioncalculation::mpftoperations::Divide(x, two_pi);
+	mpf_floor(*k, *k);
+	k = arbitraryprecisioncalculation::mpftoperations::Multiply(k, k, two_pi);
+	mpf_t* r = arbitraryprecisioncalculation::mpftoperations::Subtract(x, k);
+	std::pair<mpf_t*, mpf_t*> res = arbitraryprecisioncalculation::mpftoperations::SinCos(r);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(two_pi);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(k);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(r);
+	mpf_set_default_prec(prev_prec);
+	return res;
+}
+
+// Checks |actual - expected| < |expected| 2^-(precision - 4) and releases both values.
+bool isRelativeErrorSmall(mpf_t* actual, mpf_t* expected, int precision){
+	mpf_t* difference = arbitraryprecisioncalculation::mpftoperations::Subtract(actual, expected);
+	difference = arbitraryprecisioncalculation::mpftoperations::Abs(difference, difference);
+	mpf_t* bound = arbitraryprecisioncalculation::mpftoperations::Abs(expected);
+	bound = arbitraryprecisioncalculation::mpftoperations::Multiply2Exp(bound, bound, 4 - precision);
+	bool res = (arbitraryprecisioncalculation::mpftoperations::Compare(difference, bound) < 0);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(actual);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(expected);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(difference);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(bound);
+	return res;
+}
+
+int testLargeArgumentReduction(){
+	std::cout << "start large argument reduction test.\n";
+	int used_before = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+			- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+	int prev_prec = mpf_get_default_prec();
+	const std::vector<int> precisions = {64, 256, 512};
+	// the last value is the double closest to a multiple of pi / 2, hence its cosine is tiny
+	const std::vector<double> arguments = {ldexp(0.7, 40), -ldexp(0.9, 100), ldexp(0.55, 1000), 1e300, ldexp(6381956970095103.0, 797)};
+	for(int precision : precisions){
+		for(double argument : arguments){
+			mpf_set_default_prec(precision);
+			mpf_t* x = arbitraryprecisioncalculation::mpftoperations::ToMpft(argument);
+			std::pair<mpf_t*, mpf_t*> actual = arbitraryprecisioncalculation::mpftoperations::SinCos(x);
+			std::pair<mpf_t*, mpf_t*> expected = sinCosWithExplicitReduction(x, 2 * precision + 1200);
+			// the relative errors are checked, because one of the values can be tiny
+			int result_should_be_true = isRelativeErrorSmall(actual.first, expected.first, precision);
+			result_should_be_true &= isRelativeErrorSmall(actual.second, expected.second, precision);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(x);
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+		}
+		for(const char* argument : {"1e50", "-1e100", "1e300", "1e1000"}){
+			// unlike the doubles above these arguments use all limbs of the mantissa
+			mpf_t* x = arbitraryprecisioncalculation::mpftoperations::GetResultPointer();
+			mpf_set_str(*x, argument, 10);
+			std::pair<mpf_t*, mpf_t*> actual = arbitraryprecisioncalculation::mpftoperations::SinCos(x);
+			std::pair<mpf_t*, mpf_t*> expected = sinCosWithExplicitReduction(x, 2 * precision + 4600);
+			int result_should_be_true = isRelativeErrorSmall(actual.first, expected.first, precision);
+			result_should_be_true &= isRelativeErrorSmall(actual.second, expected.second, precision);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(x);
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+		}
+		for(int shift : {0, 3, 299}){
+			// 2^shift pi rounded to the precision is so close to a multiple of pi that most bits of its sine cancel,
+			// the small shifts are reduced without reducePayneHanek
+			mpf_t* pi = arbitraryprecisioncalculation::mpftoperations::GetPi();
+			mpf_t* x = arbitraryprecisioncalculation::mpftoperations::Multiply2Exp(pi, shift);
+			std::pair<mpf_t*, mpf_t*> actual = arbitraryprecisioncalculation::mpftoperations::SinCos(x);
+			std::pair<mpf_t*, mpf_t*> expected = sinCosWithExplicitReduction(x, 2 * precision + 1200);
+			int result_should_be_true = isRelativeErrorSmall(actual.first, expected.first, precision);
+			result_should_be_true &= isRelativeErrorSmall(actual.second, expected.second, precision);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(pi);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(x);
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+		}
+	}
+	mpf_set_default_prec(prev_prec);
+	{
+		int used_after = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+				- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+		int result_should_be_true = (used_before == used_after);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "finished large argument reduction test successfully.\n";
+	return 0;
+}
+
+int testInverseTrigonometric(){
+	std::cout << "start inverse trigonometric test.\n";
+	int used_before = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+			- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+	int prev_prec = mpf_get_default_prec();
+	const double inf = std::numeric_limits<double>::infinity();
+	// y, x and the expected angle in multiples of pi / 4
+	const std::vector<std::vector<double> > quadrants = {
+		{1.0, 1.0, 1.0}, {1.0, -1.0, 3.0}, {-1.0, -1.0, -3.0}, {-1.0, 1.0, -1.0},
+		{0.0, -1.0, 4.0}, {1.0, 0.0, 2.0}, {-2.0, 0.0, -2.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 0.0},
+		{-1.0, -inf, -4.0}, {1.0, -inf, 4.0}, {inf, 3.0, 2.0}, {inf, inf, 1.0}, {-inf, -inf, -3.0}, {2.0, inf, 0.0},
+	};
+	const std::vector<int> precisions = {64, 1024, 4096};
+	for(int precision : precisions){
+		mpf_set_default_prec(precision);
+		for(const std::vector<double>& quadrant : quadrants){
+			mpf_t* y = arbitraryprecisioncalculation::mpftoperations::ToMpft(quadrant[0]);
+			mpf_t* x = arbitraryprecisioncalculation::mpftoperations::ToMpft(quadrant[1]);
+			mpf_t* actual = arbitraryprecisioncalculation::mpftoperations::Atan2(y, x);
+			int result_should_be_true;
+			if(quadrant[2] == 0.0){
+				result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::Compare(actual, 0.0) == 0);
+				arbitraryprecisioncalculation::mpftoperations::ReleaseValue(actual);
+			} else {
+				mpf_t* pi = arbitraryprecisioncalculation::mpftoperations::GetPi();
+				mpf_t* expected = arbitraryprecisioncalculation::mpftoperations::Multiply(pi, quadrant[2] / 4.0);
+				arbitraryprecisioncalculation::mpftoperations::ReleaseValue(pi);
+				result_should_be_true = isRelativeErrorSmall(actual, expected, precision);
+			}
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(y);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(x);
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+		}
+		{
+			// the identities are well conditioned for these arguments
+			mpf_t* x = arbitraryprecisioncalculation::mpftoperations::ToMpft(-0.3);
+			mpf_t* y = arbitraryprecisioncalculation::mpftoperations::ToMpft(5.0);
+			mpf_t* arcsin = arbitraryprecisioncalculation::mpftoperations::Arcsin(x);
+			mpf_t* arccos = arbitraryprecisioncalculation::mpftoperations::Arccos(x);
+			mpf_t* arctan = arbitraryprecisioncalculation::mpftoperations::Arctan(y);
+			int result_should_be_true = isRelativeErrorSmall(arbitraryprecisioncalculation::mpftoperations::Sin(arcsin), arbitraryprecisioncalculation::mpftoperations::Clone(x), precision);
+			result_should_be_true &= isRelativeErrorSmall(arbitraryprecisioncalculation::mpftoperations::Cos(arccos), arbitraryprecisioncalculation::mpftoperations::Clone(x), precision);
+			result_should_be_true &= isRelativeErrorSmall(arbitraryprecisioncalculation::mpftoperations::Tan(arctan), arbitraryprecisioncalculation::mpftoperations::Clone(y), precision);
+			// the destination variant releases or reuses the destination
+			mpf_t* dst = arbitraryprecisioncalculation::mpftoperations::Atan2(arctan, y, x);
+			result_should_be_true &= isRelativeErrorSmall(arbitraryprecisioncalculation::mpftoperations::Tan(dst), arbitraryprecisioncalculation::mpftoperations::Divide(y, x), precision);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(x);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(y);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(arcsin);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(arccos);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(dst);
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+		}
+		for(double sign : {1.0, -1.0}){
+			// close to +-1 arcsin and arccos have to be accurate without a higher precision
+			mpf_t* x = arbitraryprecisioncalculation::mpftoperations::ToMpft(1.0);
+			mpf_t* delta = arbitraryprecisioncalculation::mpftoperations::ToMpft(1.0);
+			delta = arbitraryprecisioncalculation::mpftoperations::Multiply2Exp(delta, delta, -precision / 2);
+			delta = arbitraryprecisioncalculation::mpftoperations::Subtract(delta, x, delta);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(x);
+			x = arbitraryprecisioncalculation::mpftoperations::Multiply(delta, sign);
+			mpf_t* arcsin = arbitraryprecisioncalculation::mpftoperations::Arcsin(x);
+			mpf_t* arccos = arbitraryprecisioncalculation::mpftoperations::Arccos(x);
+			mpf_set_default_prec(2 * precision + 128);
+			mpf_t* expected_arcsin = arbitraryprecisioncalculation::mpftoperations::Arcsin(x);
+			mpf_t* expected_arccos = arbitraryprecisioncalculation::mpftoperations::Arccos(x);
+			mpf_set_default_prec(precision);
+			int result_should_be_true = isRelativeErrorSmall(arcsin, expected_arcsin, precision);
+			result_should_be_true &= isRelativeErrorSmall(arccos, expected_arccos, precision);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(x);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(delta);
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+		}
+		{
+			mpf_t* outside = arbitraryprecisioncalculation::mpftoperations::ToMpft(1.5);
+			mpf_t* infinity = arbitraryprecisioncalculation::mpftoperations::GetMinusInfinity();
+			mpf_t* undefined = arbitraryprecisioncalculation::mpftoperations::GetUndefined();
+			mpf_t* arcsin = arbitraryprecisioncalculation::mpftoperations::Arcsin(outside);
+			mpf_t* arccos = arbitraryprecisioncalculation::mpftoperations::Arccos(infinity);
+			mpf_t* arctan = arbitraryprecisioncalculation::mpftoperations::Arctan(infinity);
+			mpf_t* atan2 = arbitraryprecisioncalculation::mpftoperations::Atan2(undefined, outside);
+			int result_should_be_true = arbitraryprecisioncalculation::mpftoperations::IsUndefined(arcsin);
+			result_should_be_true &= arbitraryprecisioncalculation::mpftoperations::IsUndefined(arccos);
+			result_should_be_true &= arbitraryprecisioncalculation::mpftoperations::IsUndefined(atan2);
+			mpf_t* pi = arbitraryprecisioncalculation::mpftoperations::GetPi();
+			mpf_t* expected = arbitraryprecisioncalculation::mpftoperations::Multiply(pi, -0.5);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(pi);
+			result_should_be_true &= isRelativeErrorSmall(arctan, expected, precision);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(outside);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(infinity);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(undefined);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(arcsin);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(arccos);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(atan2);
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+		}
+	}
+	mpf_set_default_prec(prev_prec);
+	{
+		int used_after = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+				- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+		int result_should_be_true = (used_before == used_after);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "finished inverse trigonometric test successfully.\n";
+	return 0;
+}
+
+// Checks Pow for integral exponents against the exact power calculated with mpz_t.
+bool isPowExact(unsigned long base, unsigned long exponent){
+	mpf_t* value = arbitraryprecisioncalculation::mpftoperations::ToMpft((double)base);
+	mpf_t* power = arbitraryprecisioncalculation::mpftoperations::ToMpft((double)exponent);
+	mpf_t* actual = arbitraryprecisioncalculation::mpftoperations::Pow(value, power);
+	mpf_t* actual_int = arbitraryprecisioncalculation::mpftoperations::Pow(value, (int)exponent);
+	mpz_t exact;
+	mpz_init(exact);
+	mpz_ui_pow_ui(exact, base, exponent);
+	bool res = (mpf_cmp_z(*actual, exact) == 0 && mpf_cmp_z(*actual_int, exact) == 0);
+	// the reciprocal of the power is exact as well for powers of two
+	if(base == 2){
+		mpf_t* reciprocal = arbitraryprecisioncalculation::mpftoperations::Pow(value, -(int)exponent);
+		mpf_mul_2exp(*reciprocal, *reciprocal, exponent);
+		res &= (mpf_cmp_ui(*reciprocal, 1) == 0);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(reciprocal);
+	}
+	mpz_clear(exact);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(value);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(power);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(actual);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(actual_int);
+	return res;
+}
+
+int testPowExactness(){
+	std::cout << "start pow exactness test.\n";
+	int used_before = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+			- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+	int prev_prec = mpf_get_default_prec();
+	const std::vector<int> precisions = {64, 256, 1024};
+	for(int precision : precisions){
+		mpf_set_default_prec(precision);
+		{
+			// 3^40 < 2^64, 7^90 < 2^256 and 5^440 < 2^1024 fill the precision completely
+			int result_should_be_true = isPowExact(3, 40);
+			result_should_be_true &= isPowExact(2, 1000);
+			if(precision >= 256) result_should_be_true &= isPowExact(7, 90);
+			if(precision >= 1024) result_should_be_true &= isPowExact(5, 440);
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+		}
+		{
+			// negative values with integral exponents and (-1)^p for |p| > ULONG_MAX
+			mpf_t* value = arbitraryprecisioncalculation::mpftoperations::ToMpft(-1.5);
+			mpf_t* exponent = arbitraryprecisioncalculation::mpftoperations::ToMpft(-31.0);
+			mpf_t* actual = arbitraryprecisioncalculation::mpftoperations::Pow(value, exponent);
+			mpf_t* expected = arbitraryprecisioncalculation::mpftoperations::ToMpft(-pow(2.0 / 3.0, 31));
+			int result_should_be_true = isRelativeErrorSmall(actual, expected, 50);
+			mpf_t* minus_one = arbitraryprecisioncalculation::mpftoperations::ToMpft(-1.0);
+			mpf_t* even = arbitraryprecisioncalculation::mpftoperations::ToMpft(ldexp(1.0, 70));
+			mpf_t* odd = arbitraryprecisioncalculation::mpftoperations::Subtract(even, minus_one);
+			mpf_t* plus_one = arbitraryprecisioncalculation::mpftoperations::Pow(minus_one, even);
+			mpf_t* still_minus_one = arbitraryprecisioncalculation::mpftoperations::Pow(minus_one, odd);
+			mpf_t* fractional = arbitraryprecisioncalculation::mpftoperations::Pow(minus_one, 0.5);
+			result_should_be_true &= (arbitraryprecisioncalculation::mpftoperations::Compare(plus_one, 1.0) == 0);
+			result_should_be_true &= (precision < 128 || arbitraryprecisioncalculation::mpftoperations::Compare(still_minus_one, -1.0) == 0);
+			result_should_be_true &= arbitraryprecisioncalculation::mpftoperations::IsUndefined(fractional);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(value);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(exponent);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(minus_one);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(even);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(odd);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(plus_one);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(still_minus_one);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(fractional);
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+		}
+		for(double base : {0.3, 2.0, 1e30}){
+			// base^2.5 = base^2 sqrt(base) and base^-0.5 = 1 / sqrt(base)
+			mpf_t* value = arbitraryprecisioncalculation::mpftoperations::ToMpft(base);
+			mpf_t* root = arbitraryprecisioncalculation::mpftoperations::Sqrt(value);
+			mpf_t* square = arbitraryprecisioncalculation::mpftoperations::Multiply(value, value);
+			mpf_t* one = arbitraryprecisioncalculation::mpftoperations::ToMpft(1.0);
+			int result_should_be_true = isRelativeErrorSmall(arbitraryprecisioncalculation::mpftoperations::Pow(value, 2.5),
+					arbitraryprecisioncalculation::mpftoperations::Multiply(square, root), precision);
+			result_should_be_true &= isRelativeErrorSmall(arbitraryprecisioncalculation::mpftoperations::Pow(value, -0.5),
+					arbitraryprecisioncalculation::mpftoperations::Divide(one, root), precision);
+			// the fractional part of -2.3 has too many binary digits for square roots, the reference uses a higher precision
+			mpf_t* actual = arbitraryprecisioncalculation::mpftoperations::Pow(value, -2.3);
+			mpf_set_default_prec(2 * precision + 128);
+			mpf_t* log = arbitraryprecisioncalculation::mpftoperations::LogE(value);
+			mpf_t* product = arbitraryprecisioncalculation::mpftoperations::Multiply(log, -2.3);
+			mpf_t* expected = arbitraryprecisioncalculation::mpftoperations::Exp(product);
+			mpf_set_default_prec(precision);
+			result_should_be_true &= isRelativeErrorSmall(actual, expected, precision);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(log);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(product);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(value);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(root);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(square);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(one);
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+		}
+	}
+	mpf_set_default_prec(prev_prec);
+	{
+		int used_after = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+				- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+		int result_should_be_true = (used_before == used_after);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "finished pow exactness test successfully.\n";
+	return 0;
+}
+
+int testConstantRegistry(){
+	std::cout << "start constant registry test.\n";
+	int used_before = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+			- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+	int prev_prec = mpf_get_default_prec();
+	// the lower precisions after 4096 are derived from the constants calculated for 4096 bits
+	const std::vector<int> precisions = {64, 4096, 64, 256, 4106, 1024, 64};
+	for(int precision : precisions){
+		mpf_set_default_prec(precision);
+		mpf_t* one = arbitraryprecisioncalculation::mpftoperations::ToMpft(1.0);
+		mpf_t* two = arbitraryprecisioncalculation::mpftoperations::ToMpft(2.0);
+		mpf_t* ten = arbitraryprecisioncalculation::mpftoperations::ToMpft(10.0);
+		mpf_t* pi = arbitraryprecisioncalculation::mpftoperations::GetPi();
+		mpf_t* reference = arbitraryprecisioncalculation::mpftoperations::GetResultPointer();
+		int result_should_be_true = (mpf_get_prec(*pi) == mpf_get_prec(*reference));
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(reference);
+		result_should_be_true &= isRelativeErrorSmall(pi,
+				arbitraryprecisioncalculation::constantcalculation::CalculatePiChudnovsky(1, precision), precision);
+		result_should_be_true &= isRelativeErrorSmall(arbitraryprecisioncalculation::mpftoperations::GetE(),
+				arbitraryprecisioncalculation::mpftoperations::Exp(one), precision);
+		result_should_be_true &= isRelativeErrorSmall(arbitraryprecisioncalculation::mpftoperations::GetLn2(),
+				arbitraryprecisioncalculation::constantcalculation::CalculateLn2(precision), precision);
+		result_should_be_true &= isRelativeErrorSmall(arbitraryprecisioncalculation::mpftoperations::GetLn10(),
+				arbitraryprecisioncalculation::mpftoperations::LogE(ten), precision);
+		result_should_be_true &= isRelativeErrorSmall(arbitraryprecisioncalculation::mpftoperations::GetSqrt2(),
+				arbitraryprecisioncalculation::mpftoperations::Sqrt(two), precision);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(one);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(two);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(ten);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	mpf_set_default_prec(prev_prec);
+	{
+		int used_after = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+				- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+		int result_should_be_true = (used_before == used_after);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "finished constant registry test successfully.\n";
+	return 0;
+}
+
+int testIncrementalConstants(){
+	std::cout << "start incremental constants test.\n";
+	int used_before = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+			- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+	// the kept terms are extended and afterwards reused for lower precisions
+	const std::vector<int> precisions = {1000, 3000, 3010, 20000, 2000};
+	for(int precision : precisions){
+		int result_should_be_true = isRelativeErrorSmall(
+				arbitraryprecisioncalculation::constantcalculation::CalculatePiChudnovskyIncrementally(2, precision),
+				arbitraryprecisioncalculation::constantcalculation::CalculatePiChudnovsky(1, precision), precision);
+		result_should_be_true &= isRelativeErrorSmall(
+				arbitraryprecisioncalculation::constantcalculation::CalculateEIncrementally(precision),
+				arbitraryprecisioncalculation::constantcalculation::CalculateE(precision), precision);
+		result_should_be_true &= isRelativeErrorSmall(
+				arbitraryprecisioncalculation::constantcalculation::CalculateLn2Incrementally(precision),
+				arbitraryprecisioncalculation::constantcalculation::CalculateLn2(precision), precision);
+		result_should_be_true &= isRelativeErrorSmall(
+				arbitraryprecisioncalculation::constantcalculation::CalculateLogRatioIncrementally(3, 7, precision),
+				arbitraryprecisioncalculation::constantcalculation::CalculateLogRatio(3, 7, precision), precision);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int used_after = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+				- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+		int result_should_be_true = (used_before == used_after);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "finished incremental constants test successfully.\n";
+	return 0;
+}
+
+int testSeriesKernels(){
+	std::cout << "start series kernels test.\n";
+	int used_before = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+			- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+	int prev_prec = mpf_get_default_prec();
+	// the precisions lead to different block sizes and numbers of packed divisors in the series
+	const std::vector<int> precisions = {64, 200, 1000, 5000, 30000};
+	const std::vector<double> arguments = {0.3, -0.9, 2.5};
+	mpf_t* (*const functions[])(mpf_t*) = {
+			arbitraryprecisioncalculation::mpftoperations::Exp,
+			arbitraryprecisioncalculation::mpftoperations::Sin,
+			arbitraryprecisioncalculation::mpftoperations::Cos,
+			arbitraryprecisioncalculation::mpftoperations::Arctan};
+	for(int precision : precisions){
+		for(double argument : arguments){
+			for(mpf_t* (*function)(mpf_t*) : functions){
+				mpf_set_default_prec(precision);
+				mpf_t* x = arbitraryprecisioncalculation::mpftoperations::ToMpft(argument);
+				mpf_t* actual = function(x);
+				mpf_set_default_prec(2 * precision + 128);
+				mpf_t* expected = function(x);
+				mpf_set_default_prec(precision);
+				int result_should_be_true = isRelativeErrorSmall(actual, expected, precision);
+				arbitraryprecisioncalculation::mpftoperations::ReleaseValue(x);
+				assert(result_should_be_true);
+				if(!(result_should_be_true)) return 1;
+			}
+		}
+	}
+	// the multiple of ln(2) which reduces large arguments of Exp has more bits than a double
+	const std::vector<double> large_arguments = {1e20, -1e20, 3e17};
+	for(int precision : {256, 1024}){
+		for(double argument : large_arguments){
+			mpf_set_default_prec(precision);
+			mpf_t* x = arbitraryprecisioncalculation::mpftoperations::ToMpft(argument);
+			mpf_t* actual = arbitraryprecisioncalculation::mpftoperations::Exp(x);
+			mpf_set_default_prec(2 * precision + 128);
+			mpf_t* expected = arbitraryprecisioncalculation::mpftoperations::Exp(x);
+			mpf_set_default_prec(precision);
+			int result_should_be_true = isRelativeErrorSmall(actual, expected, precision);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(x);
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+		}
+	}
+	{
+		// exp overflows the exponent of mpf_t
+		mpf_t* x = arbitraryprecisioncalculation::mpftoperations::ToMpft(1e40);
+		mpf_t* overflow = arbitraryprecisioncalculation::mpftoperations::Exp(x);
+		mpf_neg(*x, *x);
+		mpf_t* underflow = arbitraryprecisioncalculation::mpftoperations::Exp(x);
+		int result_should_be_true = arbitraryprecisioncalculation::mpftoperations::IsPlusInfinity(overflow);
+		result_should_be_true &= (mpf_sgn(*underflow) == 0);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(x);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(overflow);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(underflow);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	mpf_set_default_prec(prev_prec);
+	{
+		int used_after = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+				- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+		int result_should_be_true = (used_before == used_after);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "finished series kernels test successfully.\n";
+	return 0;
+}
+
+int testAlgorithmSelection(){
+	std::cout << "start algorithm selection test.\n";
+	int used_before = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+			- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+	int prev_prec = mpf_get_default_prec();
+	arbitraryprecisioncalculation::configuration::TrigonometricAlgorithm prev_trigonometric_algorithm = arbitraryprecisioncalculation::Configuration::getTrigonometricAlgorithm();
+	unsigned long prev_cordic_minimal_precision = arbitraryprecisioncalculation::Configuration::getCordicMinimalPrecision();
+	arbitraryprecisioncalculation::configuration::LogarithmAlgorithm prev_logarithm_algorithm = arbitraryprecisioncalculation::Configuration::getLogarithmAlgorithm();
+	unsigned long prev_log_agm_minimal_precision = arbitraryprecisioncalculation::Configuration::getLogAgmMinimalPrecision();
+	const std::vector<int> precisions = {64, 1000, 5000};
+	// the expected values are calculated by the Taylor series and the series of the logarithm
+	const std::vector<double> angles = {0.3, -2.5, 1e-12, 10.0};
+	const std::vector<double> logarithm_arguments = {0.3, 2.5, 1e10, 1.0000001};
+	for(int precision : precisions){
+		for(double argument : angles){
+			mpf_set_default_prec(precision);
+			arbitraryprecisioncalculation::Configuration::setTrigonometricAlgorithm(arbitraryprecisioncalculation::configuration::TRIGONOMETRIC_ALGORITHM_CORDIC);
+			mpf_t* x = arbitraryprecisioncalculation::mpftoperations::ToMpft(argument);
+			std::pair<mpf_t*, mpf_t*> actual = arbitraryprecisioncalculation::mpftoperations::SinCos(x);
+			mpf_set_default_prec(2 * precision + 128);
+			arbitraryprecisioncalculation::Configuration::setTrigonometricAlgorithm(arbitraryprecisioncalculation::configuration::TRIGONOMETRIC_ALGORITHM_TAYLOR);
+			std::pair<mpf_t*, mpf_t*> expected = arbitraryprecisioncalculation::mpftoperations::SinCos(x);
+			mpf_set_default_prec(precision);
+			int result_should_be_true = isRelativeErrorSmall(actual.first, expected.first, precision);
+			result_should_be_true &= isRelativeErrorSmall(actual.second, expected.second, precision);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(x);
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+		}
+		for(double argument : logarithm_arguments){
+			mpf_set_default_prec(precision);
+			arbitraryprecisioncalculation::Configuration::setLogarithmAlgorithm(arbitraryprecisioncalculation::configuration::LOGARITHM_ALGORITHM_AGM);
+			mpf_t* x = arbitraryprecisioncalculation::mpftoperations::ToMpft(argument);
+			mpf_t* actual = arbitraryprecisioncalculation::mpftoperations::LogE(x);
+			mpf_set_default_prec(2 * precision + 128);
+			arbitraryprecisioncalculation::Configuration::setLogarithmAlgorithm(arbitraryprecisioncalculation::configuration::LOGARITHM_ALGORITHM_SERIES);
+			mpf_t* expected = arbitraryprecisioncalculation::mpftoperations::LogE(x);
+			mpf_set_default_prec(precision);
+			int result_should_be_true = isRelativeErrorSmall(actual, expected, precision);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(x);
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+		}
+	}
+	mpf_set_default_prec(prev_prec);
+	{
+		// the tuner selects the automatic algorithms with thresholds from the grid
+		const std::vector<mp_bitcnt_t> grid = {128, 256};
+		arbitraryprecisioncalculation::mpftoperations::TuneAlgorithms(grid);
+		unsigned long cordic_minimal_precision = arbitraryprecisioncalculation::Configuration::getCordicMinimalPrecision();
+		unsigned long log_agm_minimal_precision = arbitraryprecisioncalculation::Configuration::getLogAgmMinimalPrecision();
+		int result_should_be_true = (arbitraryprecisioncalculation::Configuration::getTrigonometricAlgorithm() == arbitraryprecisioncalculation::configuration::TRIGONOMETRIC_ALGORITHM_AUTOMATIC);
+		result_should_be_true &= (arbitraryprecisioncalculation::Configuration::getLogarithmAlgorithm() == arbitraryprecisioncalculation::configuration::LOGARITHM_ALGORITHM_AUTOMATIC);
+		result_should_be_true &= (cordic_minimal_precision == grid[0] || cordic_minimal_precision == grid[1] || cordic_minimal_precision == ULONG_MAX);
+		result_should_be_true &= (log_agm_minimal_precision == grid[0] || log_agm_minimal_precision == grid[1] || log_agm_minimal_precision == ULONG_MAX);
+		result_should_be_true &= ((int)mpf_get_default_prec() == prev_prec);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		// a stored profile restores the selection
+		const char* file_name = "test_algorithm_profile.tmp";
+		arbitraryprecisioncalculation::Configuration::setTrigonometricAlgorithm(arbitraryprecisioncalculation::configuration::TRIGONOMETRIC_ALGORITHM_CORDIC);
+		arbitraryprecisioncalculation::Configuration::setCordicMinimalPrecision(1234);
+		arbitraryprecisioncalculation::Configuration::setLogarithmAlgorithm(arbitraryprecisioncalculation::configuration::LOGARITHM_ALGORITHM_SERIES);
+		arbitraryprecisioncalculation::Configuration::setLogAgmMinimalPrecision(ULONG_MAX);
+		{
+			std::ofstream output(file_name);
+			arbitraryprecisioncalculation::Configuration::StoreAlgorithmProfile(&output);
+		}
+		arbitraryprecisioncalculation::Configuration::setTrigonometricAlgorithm(arbitraryprecisioncalculation::configuration::TRIGONOMETRIC_ALGORITHM_AUTOMATIC);
+		arbitraryprecisioncalculation::Configuration::setCordicMinimalPrecision(0);
+		arbitraryprecisioncalculation::Configuration::setLogarithmAlgorithm(arbitraryprecisioncalculation::configuration::LOGARITHM_ALGORITHM_AGM);
+		arbitraryprecisioncalculation::Configuration::setLogAgmMinimalPrecision(0);
+		{
+			std::ifstream input(file_name);
+			arbitraryprecisioncalculation::Configuration::LoadAlgorithmProfile(&input);
+		}
+		std::remove(file_name);
+		int result_should_be_true = (arbitraryprecisioncalculation::Configuration::getTrigonometricAlgorithm() == arbitraryprecisioncalculation::configuration::TRIGONOMETRIC_ALGORITHM_CORDIC);
+		result_should_be_true &= (arbitraryprecisioncalculation::Configuration::getCordicMinimalPrecision() == 1234);
+		result_should_be_true &= (arbitraryprecisioncalculation::Configuration::getLogarithmAlgorithm() == arbitraryprecisioncalculation::configuration::LOGARITHM_ALGORITHM_SERIES);
+		result_should_be_true &= (arbitraryprecisioncalculation::Configuration::getLogAgmMinimalPrecision() == ULONG_MAX);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	arbitraryprecisioncalculation::Configuration::setTrigonometricAlgorithm(prev_trigonometric_algorithm);
+	arbitraryprecisioncalculation::Configuration::setCordicMinimalPrecision(prev_cordic_minimal_precision);
+	arbitraryprecisioncalculation::Configuration::setLogarithmAlgorithm(prev_logarithm_algorithm);
+	arbitraryprecisioncalculation::Configuration::setLogAgmMinimalPrecision(prev_log_agm_minimal_precision);
+	{
+		int used_after = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+				- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+		int result_should_be_true = (used_before == used_after);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "finished algorithm selection test successfully.\n";
+	return 0;
+}
+
+// Returns a reference value of a hyperbolic function which is calculated with the exponential function and the logarithm
+// with the current precision. The formulas cancel bits for small arguments, hence the current precision has to be large enough.
+mpf_t* hyperbolicReference(const std::string & function, mpf_t* x){
+	mpf_t* one = arbitraryprecisioncalculation::mpftoperations::ToMpft(1.0);
+	mpf_t* res = NULL;
+	if(function == "sinh" || function == "cosh" || function == "tanh"){
+		mpf_t* exp_x = arbitraryprecisioncalculation::mpftoperations::Exp(x);
+		mpf_t* exp_minus_x = arbitraryprecisioncalculation::mpftoperations::Divide(one, exp_x);
+		mpf_t* difference = arbitraryprecisioncalculation::mpftoperations::SubtractNoCheck(exp_x, exp_minus_x);
+		mpf_t* sum = arbitraryprecisioncalculation::mpftoperations::Add(exp_x, exp_minus_x);
+		if(function == "sinh"){
+			res = arbitraryprecisioncalculation::mpftoperations::Multiply2Exp(difference, -1);
+		} else if(function == "cosh"){
+			res = arbitraryprecisioncalculation::mpftoperations::Multiply2Exp(sum, -1);
+		} else {
+			res = arbitraryprecisioncalculation::mpftoperations::Divide(difference, sum);
+		}
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(exp_x);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(exp_minus_x);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(difference);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(sum);
+	} else if(function == "atanh"){
+		// atanh(x) = ln((1 + x) / (1 - x)) / 2
+		mpf_t* numerator = arbitraryprecisioncalculation::mpftoperations::Add(one, x);
+		mpf_t* denominator = arbitraryprecisioncalculation::mpftoperations::SubtractNoCheck(one, x);
+		mpf_t* quotient = arbitraryprecisioncalculation::mpftoperations::Divide(numerator, denominator);
+		mpf_t* logarithm = arbitraryprecisioncalculation::mpftoperations::LogE(quotient);
+		res = arbitraryprecisioncalculation::mpftoperations::Multiply2Exp(logarithm, -1);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(numerator);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(denominator);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(quotient);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(logarithm);
+	} else {
+		// asinh(x) = ln(x + sqrt(x^2 + 1)) and acosh(x) = ln(x + sqrt(x^2 - 1))
+		mpf_t* square = arbitraryprecisioncalculation::mpftoperations::Multiply(x, x);
+		mpf_t* radicand = (function == "asinh" ? arbitraryprecisioncalculation::mpftoperations::Add(square, one)
+				: arbitraryprecisioncalculation::mpftoperations::SubtractNoCheck(square, one));
+		mpf_t* root = arbitraryprecisioncalculation::mpftoperations::Sqrt(radicand);
+		mpf_t* sum = arbitraryprecisioncalculation::mpftoperations::AddNoCheck(x, root);
+		res = arbitraryprecisioncalculation::mpftoperations::LogE(sum);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(square);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(radicand);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(root);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(sum);
+	}
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(one);
+	return res;
+}
+
+int testHyperbolic(){
+	std::cout << "start hyperbolic test.\n";
+	int used_before = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+			- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+	int prev_prec = mpf_get_default_prec();
+	const std::vector<int> precisions = {64, 200, 1000, 5000};
+	// the arguments cover the series for small arguments and the evaluations by the exponential function or the logarithm
+	const std::vector<std::pair<std::string, mpf_t* (*)(mpf_t*)> > functions = {
+		{"sinh", arbitraryprecisioncalculation::mpftoperations::Sinh},
+		{"cosh", arbitraryprecisioncalculation::mpftoperations::Cosh},
+		{"tanh", arbitraryprecisioncalculation::mpftoperations::Tanh},
+		{"asinh", arbitraryprecisioncalculation::mpftoperations::Asinh},
+		{"acosh", arbitraryprecisioncalculation::mpftoperations::Acosh},
+		{"atanh", arbitraryprecisioncalculation::mpftoperations::Atanh}};
+	const std::vector<std::vector<double> > arguments = {
+		{0.3, -0.9, 2.5, 1e-10, -40.0},
+		{0.3, -0.9, 2.5, 1e-10, -40.0},
+		{0.3, -0.9, 2.5, 1e-10, -40.0},
+		{0.3, -0.9, 2.5, 1e-10, -1e20},
+		{1.2, 1.0000001, 3.5, 1e20},
+		{0.3, -0.9, 1e-10, 0.75}};
+	for(int precision : precisions){
+		for(unsigned int i = 0; i < functions.size(); i++){
+			for(double argument : arguments[i]){
+				mpf_set_default_prec(precision);
+				mpf_t* x = arbitraryprecisioncalculation::mpftoperations::ToMpft(argument);
+				mpf_t* actual = functions[i].second(x);
+				// the reference formulas cancel at most 40 bits for these arguments
+				mpf_set_default_prec(2 * precision + 128);
+				mpf_t* expected = hyperbolicReference(functions[i].first, x);
+				mpf_set_default_prec(precision);
+				int result_should_be_true = isRelativeErrorSmall(actual, expected, precision);
+				arbitraryprecisioncalculation::mpftoperations::ReleaseValue(x);
+				assert(result_should_be_true);
+				if(!(result_should_be_true)) return 1;
+			}
+		}
+		{
+			// SinhCosh and the destination variants match the separate calls
+			mpf_set_default_prec(precision);
+			mpf_t* x = arbitraryprecisioncalculation::mpftoperations::ToMpft(-0.7);
+			mpf_t* dst = arbitraryprecisioncalculation::mpftoperations::ToMpft(5.0);
+			std::pair<mpf_t*, mpf_t*> sinh_cosh = arbitraryprecisioncalculation::mpftoperations::SinhCosh(dst, NULL, x);
+			mpf_t* sinh_x = arbitraryprecisioncalculation::mpftoperations::Sinh(x);
+			mpf_t* cosh_x = arbitraryprecisioncalculation::mpftoperations::Cosh(x);
+			int result_should_be_true = (mpf_cmp(*sinh_cosh.first, *sinh_x) == 0 && mpf_cmp(*sinh_cosh.second, *cosh_x) == 0);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(sinh_cosh.first);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(sinh_cosh.second);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(sinh_x);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(cosh_x);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(x);
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+		}
+	}
+	mpf_set_default_prec(prev_prec);
+	{
+		// the same conventions for infinite and undefined values as for Exp and LogE
+		mpf_t* plus_infinity = arbitraryprecisioncalculation::mpftoperations::GetPlusInfinity();
+		mpf_t* minus_infinity = arbitraryprecisioncalculation::mpftoperations::GetMinusInfinity();
+		mpf_t* undefined = arbitraryprecisioncalculation::mpftoperations::GetUndefined();
+		mpf_t* one = arbitraryprecisioncalculation::mpftoperations::ToMpft(1.0);
+		mpf_t* minus_one = arbitraryprecisioncalculation::mpftoperations::ToMpft(-1.0);
+		mpf_t* two = arbitraryprecisioncalculation::mpftoperations::ToMpft(2.0);
+		mpf_t* half = arbitraryprecisioncalculation::mpftoperations::ToMpft(0.5);
+		std::vector<mpf_t*> results = {
+			arbitraryprecisioncalculation::mpftoperations::Sinh(minus_infinity),
+			arbitraryprecisioncalculation::mpftoperations::Cosh(minus_infinity),
+			arbitraryprecisioncalculation::mpftoperations::Tanh(minus_infinity),
+			arbitraryprecisioncalculation::mpftoperations::Asinh(plus_infinity),
+			arbitraryprecisioncalculation::mpftoperations::Acosh(plus_infinity),
+			arbitraryprecisioncalculation::mpftoperations::Acosh(half),
+			arbitraryprecisioncalculation::mpftoperations::Acosh(one),
+			arbitraryprecisioncalculation::mpftoperations::Atanh(one),
+			arbitraryprecisioncalculation::mpftoperations::Atanh(minus_one),
+			arbitraryprecisioncalculation::mpftoperations::Atanh(two),
+			arbitraryprecisioncalculation::mpftoperations::Sinh(undefined)};
+		int result_should_be_true = arbitraryprecisioncalculation::mpftoperations::IsMinusInfinity(results[0]);
+		result_should_be_true &= arbitraryprecisioncalculation::mpftoperations::IsPlusInfinity(results[1]);
+		result_should_be_true &= (arbitraryprecisioncalculation::mpftoperations::Compare(results[2], -1.0) == 0);
+		result_should_be_true &= arbitraryprecisioncalculation::mpftoperations::IsPlusInfinity(results[3]);
+		result_should_be_true &= arbitraryprecisioncalculation::mpftoperations::IsPlusInfinity(results[4]);
+		result_should_be_true &= arbitraryprecisioncalculation::mpftoperations::IsUndefined(results[5]);
+		result_should_be_true &= (arbitraryprecisioncalculation::mpftoperations::Compare(results[6], 0.0) == 0);
+		result_should_be_true &= arbitraryprecisioncalculation::mpftoperations::IsPlusInfinity(results[7]);
+		result_should_be_true &= arbitraryprecisioncalculation::mpftoperations::IsMinusInfinity(results[8]);
+		result_should_be_true &= arbitraryprecisioncalculation::mpftoperations::IsUndefined(results[9]);
+		result_should_be_true &= arbitraryprecisioncalculation::mpftoperations::IsUndefined(results[10]);
+		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(results);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(plus_infinity);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(minus_infinity);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(undefined);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(one);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(minus_one);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(two);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(half);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		// exp(|v|) overflows the exponent of mpf_t, hence the results are infinite instead of wrapped around
+		mpf_t* huge = arbitraryprecisioncalculation::mpftoperations::ToMpft(1e40);
+		mpf_t* minus_huge = arbitraryprecisioncalculation::mpftoperations::ToMpft(-1e40);
+		std::pair<mpf_t*, mpf_t*> sinh_cosh = arbitraryprecisioncalculation::mpftoperations::SinhCosh(minus_huge);
+		std::vector<mpf_t*> results = {
+			arbitraryprecisioncalculation::mpftoperations::Sinh(huge),
+			arbitraryprecisioncalculation::mpftoperations::Sinh(minus_huge),
+			arbitraryprecisioncalculation::mpftoperations::Cosh(huge),
+			arbitraryprecisioncalculation::mpftoperations::Cosh(minus_huge),
+			arbitraryprecisioncalculation::mpftoperations::Tanh(huge),
+			sinh_cosh.first,
+			sinh_cosh.second};
+		int result_should_be_true = arbitraryprecisioncalculation::mpftoperations::IsPlusInfinity(results[0]);
+		result_should_be_true &= arbitraryprecisioncalculation::mpftoperations::IsMinusInfinity(results[1]);
+		result_should_be_true &= arbitraryprecisioncalculation::mpftoperations::IsPlusInfinity(results[2]);
+		result_should_be_true &= arbitraryprecisioncalculation::mpftoperations::IsPlusInfinity(results[3]);
+		result_should_be_true &= (arbitraryprecisioncalculation::mpftoperations::Compare(results[4], 1.0) == 0);
+		result_should_be_true &= arbitraryprecisioncalculation::mpftoperations::IsMinusInfinity(results[5]);
+		result_should_be_true &= arbitraryprecisioncalculation::mpftoperations::IsPlusInfinity(results[6]);
+		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(results);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(huge);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(minus_huge);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int used_after = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+				- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+		int result_should_be_true = (used_before == used_after);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "finished hyperbolic test successfully.\n";
+	return 0;
+}
+
+int testReal(){
+	std::cout << "start real test.\n";
+	int used_before = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+			- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+	{
+		arbitraryprecisioncalculation::Real a(1.5);
+		arbitraryprecisioncalculation::Real b(-0.25);
+		arbitraryprecisioncalculation::Real c = a * b + a / b - (a - b);
+		mpf_t* ab = arbitraryprecisioncalculation::mpftoperations::Multiply(a.Get(), b.Get());
+		mpf_t* adb = arbitraryprecisioncalculation::mpftoperations::Divide(a.Get(), b.Get());
+		mpf_t* amb = arbitraryprecisioncalculation::mpftoperations::Subtract(a.Get(), b.Get());
+		mpf_t* sum = arbitraryprecisioncalculation::mpftoperations::Add(ab, adb);
+		mpf_t* expected = arbitraryprecisioncalculation::mpftoperations::Subtract(sum, amb);
+		int result_should_be_true = (mpf_cmp(*c.Get(), *expected) == 0 && c.ToDouble() == 1.5 * -0.25 + 1.5 / -0.25 - 1.75);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(ab);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(adb);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(amb);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(sum);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(expected);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		// expiring temporaries are reused for the result
+		arbitraryprecisioncalculation::Real a(3.0);
+		arbitraryprecisioncalculation::Real b(4.0);
+		mpf_t* storage = a.Get();
+		arbitraryprecisioncalculation::Real c = -(std::move(a) * b + b);
+		arbitraryprecisioncalculation::Real d(c);
+		d = b;
+		int result_should_be_true = (c.Get() == storage && c == -16.0 && d == b && d.Get() != b.Get());
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		// special values have the same semantics as the mpf_t operations
+		arbitraryprecisioncalculation::Real inf(INFINITY);
+		arbitraryprecisioncalculation::Real zero(0);
+		arbitraryprecisioncalculation::Real a = inf - 1.0;
+		arbitraryprecisioncalculation::Real b = zero * inf;
+		arbitraryprecisioncalculation::Real c = 1.0 / inf;
+		a += 2.0;
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::IsPlusInfinity(a.Get())
+				&& arbitraryprecisioncalculation::mpftoperations::IsUndefined(b.Get())
+				&& c == 0.0 && -inf < c);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int used_after = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+				- arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
+		int result_should_be_true = (used_before == used_after);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "finished real test successfully.\n";
+	return 0;
+}
+
 int signum(int v){
 	if(v == 0)return 0;
 	if(v < 0)return -1;
@@ -962,6 +2666,121 @@ int testOperations(){
 		assert(result_should_be_true);
 		if(!(result_should_be_true)) return 1;
 	}
+	{
+		int result_should_be_true = (testStoreAndLoadMpft() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (testThreads() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (testDestinationOperations() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (testScopedMpftArena() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (testScopedMpftArenaThreads() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (testTrimMpftPool() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (testReal() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (testLimbAllocator() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (testPrecisionCheck() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (testPrecisionCheckPolicies() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (testPrecisionController() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (testPiAlgorithms() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (testExpArgumentReduction() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (testLogArgumentReduction() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (testSinCos() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (testLargeArgumentReduction() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (testInverseTrigonometric() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (testPowExactness() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (testConstantRegistry() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (testIncrementalConstants() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (testSeriesKernels() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (testAlgorithmSelection() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (testHyperbolic() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
 	{
 		int result_should_be_true = (testCompare() == 0);
 		assert(result_should_be_true);
@@ -1086,6 +2905,8 @@ int test_randomNumberGenerator(){
 }
 
 int start_tests(int argv, char * argc[]) {
+	// has to be done before any mpf_t is initialized
+	arbitraryprecisioncalculation::LimbAllocator::Install(false);
 	arbitraryprecisioncalculation::Configuration::setOutputPrecision(10);
 	arbitraryprecisioncalculation::Configuration::setInitialPrecision(BASE_PRECISION);
 	arbitraryprecisioncalculation::Configuration::setPrecisionSafetyMargin(BASE_PRECISION / 2);